@@ -0,0 +1,29 @@
+#include <Arduino.h>
+#include <Adafruit_GFX.h>           // Core library for graphics (GFX)  & text 
+#include "PL_smallLegio.h"          // Display-specific library for 4pigment media (Legio, 6colors)
+
+#include "IMG_trafficLights.h"      // All traffic light images in one bundle, built with
+                                    // extras/bundlePacker from ../03_Trafficlight
+#define EPD_RST     12
+#define EPD_BUSY    9
+#define EPD_CS      5
+                                    // Declare 4pigment based EPD instance with 6 colors
+PL_smallLegio epd(EPD_CS, EPD_RST, EPD_BUSY);   
+
+const uint16_t sequence[] = { IMG_TRAFFICLIGHTS_TRAFFICLIGHT_R, IMG_TRAFFICLIGHTS_TRAFFICLIGHT_Y,
+                              IMG_TRAFFICLIGHTS_TRAFFICLIGHT_G };
+
+void setup() {  
+    SPI.begin();                    // SPI initialisation, UC8156 supp. max 10Mhz (writing) & 
+    SPI.beginTransaction(SPISettings(6000000, MSBFIRST, SPI_MODE0));      // 6.6Mhz (reading)
+
+    epd.begin(EPD_BLACK);           // EPD initialisation & ClearScreen
+}
+
+void loop() {       
+    for (int i = 0; i < 3; i++) {
+        epd.showImage(IMG_trafficLights, sequence[i]);   // Lookup by ID, no scanning
+        delay(10000);
+        epd.clearScreen(EPD_BLACK);
+    }
+}
@@ -0,0 +1,644 @@
+#ifndef IMG_TRAFFICLIGHTS_h
+#define IMG_TRAFFICLIGHTS_h
+
+// Image bundle built by bundlePacker: 4 images, 8 planes stored, 15106 bytes
+
+#define IMG_TRAFFICLIGHTS_TRAFFICLIGHT_G 0
+#define IMG_TRAFFICLIGHTS_TRAFFICLIGHT_R 1
+#define IMG_TRAFFICLIGHTS_TRAFFICLIGHT_RYG 2
+#define IMG_TRAFFICLIGHTS_TRAFFICLIGHT_Y 3
+
+const unsigned char IMG_trafficLights[] PROGMEM = {
+    0x50,0x4C,0x42,0x31,0x04,0x00,0x08,0x00,0x74,0x72,0x61,0x66,0x66,0x69,0x63,0x4C,0x69,0x67,0x68,0x74,0x5F,0x67,0x00,0x00,
+    0xE0,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0xFF,0xFF,0xFF,0xFF,0x74,0x72,0x61,0x66,0x66,0x69,0x63,0x4C,0x69,0x67,0x68,0x74,
+    0x5F,0x72,0x00,0x00,0x90,0x00,0x02,0x00,0xFF,0xFF,0xFF,0xFF,0x03,0x00,0xFF,0xFF,0x74,0x72,0x61,0x66,0x66,0x69,0x63,0x4C,
+    0x69,0x67,0x68,0x74,0x5F,0x72,0x79,0x67,0xF0,0x00,0x04,0x00,0x05,0x00,0x01,0x00,0x03,0x00,0xFF,0xFF,0x74,0x72,0x61,0x66,
+    0x66,0x69,0x63,0x4C,0x69,0x67,0x68,0x74,0x5F,0x79,0x00,0x00,0xC0,0x00,0x06,0x00,0x07,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xB8,0x00,0x00,0x00,0xA0,0x0C,0x01,0x00,0x58,0x0D,0x00,0x00,0xA1,0x01,0x01,0x00,0xF9,0x0E,0x00,0x00,0xA3,0x0C,0x01,0x00,
+    0x9C,0x1B,0x00,0x00,0xA6,0x01,0x01,0x00,0x42,0x1D,0x00,0x00,0x92,0x0C,0x01,0x00,0xD4,0x29,0x00,0x00,0xE6,0x02,0x01,0x00,
+    0xBA,0x2C,0x00,0x00,0xA1,0x0C,0x01,0x00,0x5B,0x39,0x00,0x00,0xA7,0x01,0x01,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0x86,0xFF,0x02,0xFC,0x00,0x03,0x89,0xFF,0x02,0xC0,0x00,0x3F,0x88,0xFF,0x02,0xFC,0x00,0x03,0x99,0xFF,
+    0x03,0xF0,0x00,0x00,0x0F,0x88,0xFF,0x80,0x00,0x88,0xFF,0x03,0xF0,0x00,0x00,0x0F,0x98,0xFF,0x00,0xF0,0x80,0x00,0x88,0xFF,
+    0x80,0x00,0x00,0x0F,0x87,0xFF,0x00,0xF0,0x80,0x00,0x98,0xFF,0x04,0xF0,0x3F,0xF0,0x00,0x0F,0x87,0xFF,0x03,0x00,0xFF,0x00,
+    0x00,0x87,0xFF,0x04,0xF0,0x3F,0xF0,0x00,0x0F,0x97,0xFF,0x04,0xF0,0x3F,0xFF,0xC0,0x03,0x87,0xFF,0x04,0x00,0xFF,0xFC,0x00,
+    0x3F,0x86,0xFF,0x04,0xF0,0x3F,0xFF,0xC0,0x00,0x97,0xFF,0x04,0xF0,0x3F,0xFF,0xFC,0x00,0x87,0xFF,0x04,0x00,0xFF,0xFF,0xC0,
+    0x0F,0x86,0xFF,0x05,0xF0,0x3F,0xFF,0xFC,0x00,0x3F,0x96,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xC0,0x3F,0x86,0xFF,0x04,0x00,0xFF,
+    0xFF,0xFC,0x03,0x86,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xC0,0x0F,0x96,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xF0,0x0F,0x86,0xFF,0x00,
+    0x00,0x80,0xFF,0x00,0x00,0x86,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xF0,0x0F,0x96,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xFC,0x03,0x86,
+    0xFF,0x00,0x00,0x80,0xFF,0x01,0xC0,0x3F,0x85,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xFC,0x03,0x96,0xFF,0x01,0xF0,0x3F,0x80,0xFF,
+    0x00,0x03,0x86,0xFF,0x00,0x00,0x80,0xFF,0x01,0xF0,0x3F,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x00,0x00,0x96,0xFF,0x01,0xF0,
+    0x3F,0x80,0xFF,0x00,0x00,0x86,0xFF,0x00,0x00,0x80,0xFF,0x01,0xF0,0x0F,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x00,0xC0,0x96,
+    0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x00,0xC0,0x86,0xFF,0x00,0x00,0x80,0xFF,0x01,0xFC,0x03,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,
+    0x01,0xC0,0x3F,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xC0,0x3F,0x85,0xFF,0x00,0x00,0x80,0xFF,0x01,0xFC,0x03,0x85,0xFF,
+    0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x3F,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x3F,0x85,0xFF,0x00,0x00,0x81,0xFF,
+    0x00,0x03,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x0F,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x0F,0x85,0xFF,
+    0x00,0x00,0x81,0xFF,0x00,0x00,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x0F,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,
+    0xF0,0x0F,0x85,0xFF,0x00,0x00,0x81,0xFF,0x00,0xC0,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x0F,0x95,0xFF,0x01,0xF0,
+    0x3F,0x80,0xFF,0x01,0xFC,0x0F,0x85,0xFF,0x00,0x00,0x81,0xFF,0x00,0xC0,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x0F,
+    0x95,0xFF,0x00,0xF0,0x9F,0x00,0x00,0x03,0x93,0xFF,0x00,0xFC,0xA9,0x00,0x00,0x3F,0x8B,0xFF,0x00,0xC0,0xA9,0x00,0x00,0x03,
+    0x8B,0xFF,0xAB,0x00,0x8A,0xFF,0x01,0xFC,0x00,0xA9,0xFF,0x01,0x00,0x3F,0x89,0xFF,0x01,0xFC,0x0F,0xA9,0xFF,0x01,0xC0,0x3F,
+    0x89,0xFF,0x01,0xF0,0x0F,0xA9,0xFF,0x01,0xF0,0x3F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xF0,0x0F,0x89,0xFF,0x01,0xF0,
+    0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,
+    0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,0xFF,
+    0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x84,0xFF,0x00,0x3F,0x8A,0xFF,0x00,0x0F,0x8A,0xFF,0x00,
+    0xF0,0x85,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x82,0xFF,0x02,0xFC,0x00,0x03,0x88,0xFF,0x02,0xFC,0x00,0x03,0x89,
+    0xFF,0x02,0xF0,0x00,0x3F,0x84,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x82,0xFF,0x02,0x00,0x00,0x03,0x88,0xFF,0x02,
+    0xC0,0x00,0x03,0x88,0xFF,0x03,0xFC,0x00,0x00,0x0F,0x84,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x81,0xFF,0x03,0xFC,
+    0x00,0x00,0x0F,0x87,0xFF,0x03,0xFC,0x00,0x00,0x0F,0x88,0xFF,0x03,0xC0,0x00,0x00,0x3F,0x84,0xFF,0x01,0xFC,0x0F,0x89,0xFF,
+    0x01,0xF0,0x3F,0x81,0xFF,0x02,0x00,0x00,0x0F,0x88,0xFF,0x02,0xC0,0x00,0x0F,0x88,0xFF,0x02,0xFC,0x00,0x00,0x86,0xFF,0x01,
+    0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x02,0xFC,0x00,0x03,0x88,0xFF,0x02,0xFC,0x00,0x03,0x89,0xFF,0x02,0xC0,0x00,
+    0x3F,0x86,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x00,0x89,0xFF,0x01,0xF0,0x00,0x8A,0xFF,0x01,
+    0x00,0x03,0x87,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x03,0x00,0x0F,0xFF,0xFF,0x80,0x00,0x84,0xFF,0x03,
+    0xC0,0x0F,0xFF,0xFF,0x80,0x00,0x84,0xFF,0x07,0xFC,0x00,0x3F,0xFF,0xFC,0x00,0x00,0x03,0x82,0xFF,0x01,0xFC,0x0F,0x89,0xFF,
+    0x08,0xF0,0x3F,0xFF,0xFF,0xFC,0x00,0x3F,0xFF,0xC0,0x80,0x00,0x00,0x03,0x83,0xFF,0x03,0x00,0x3F,0xFF,0xC0,0x80,0x00,0x00,
+    0x03,0x83,0xFF,0x03,0xF0,0x03,0xFF,0xFF,0x81,0x00,0x00,0x0F,0x81,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x0D,0xF0,0x3F,0xFF,0xFF,
+    0xF0,0x03,0xFF,0xFC,0x00,0x0F,0xFF,0xF0,0x00,0x3F,0x81,0xFF,0x09,0xFC,0x00,0xFF,0xFC,0x00,0x0F,0xFF,0xF0,0x00,0x3F,0x82,
+    0xFF,0x03,0xC0,0x0F,0xFF,0xF0,0x82,0x00,0x81,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x08,0xF0,0x3F,0xFF,0xFF,0xF0,0x0F,0xFF,0xF0,
+    0x0F,0x80,0xFF,0x01,0xF0,0x0F,0x81,0xFF,0x04,0xF0,0x03,0xFF,0xF0,0x0F,0x80,0xFF,0x01,0xF0,0x03,0x82,0xFF,0x02,0x00,0x3F,
+    0xFF,0x83,0x00,0x00,0x3F,0x80,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x07,0xF0,0x3F,0xFF,0xFF,0xC0,0x3F,0xFF,0x00,0x82,0xFF,0x00,
+    0x00,0x81,0xFF,0x03,0xC0,0x0F,0xFF,0xC0,0x82,0xFF,0x00,0x00,0x82,0xFF,0x02,0x00,0xFF,0xFC,0x83,0x00,0x00,0x0F,0x80,0xFF,
+    0x01,0xFC,0x0F,0x89,0xFF,0x07,0xF0,0x3F,0xFF,0xFF,0x00,0xFF,0xFC,0x03,0x82,0xFF,0x01,0xC0,0x3F,0x80,0xFF,0x03,0xC0,0x3F,
+    0xFC,0x03,0x82,0xFF,0x01,0xC0,0x3F,0x80,0xFF,0x03,0xFC,0x03,0xFF,0xF0,0x84,0x00,0x80,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x07,
+    0xF0,0x3F,0xFF,0xFF,0x00,0xFF,0xF0,0x3F,0x82,0xFF,0x01,0xFC,0x0F,0x80,0xFF,0x03,0x00,0xFF,0xF0,0x3F,0x82,0xFF,0x01,0xFC,
+    0x0F,0x80,0xFF,0x03,0xF0,0x0F,0xFF,0xC0,0x84,0x00,0x04,0x3F,0xFF,0xFF,0xFC,0x0F,0x89,0xFF,0x06,0xF0,0x3F,0xFF,0xFC,0x03,
+    0xFF,0xC0,0x84,0xFF,0x00,0x03,0x80,0xFF,0x02,0x00,0xFF,0xF0,0x84,0xFF,0x00,0x03,0x80,0xFF,0x02,0xF0,0x0F,0xFF,0x85,0x00,
+    0x04,0x0F,0xFF,0xFF,0xFC,0x0F,0x89,0xFF,0x06,0xF0,0x3F,0xFF,0xFC,0x03,0xFF,0x03,0x84,0xFF,0x06,0xC0,0xFF,0xFF,0xFC,0x03,
+    0xFF,0xC3,0x84,0xFF,0x00,0xC0,0x80,0xFF,0x02,0xC0,0x3F,0xFC,0x85,0x00,0x04,0x0F,0xFF,0xFF,0xFC,0x0F,0x89,0xFF,0x06,0xF0,
+    0x3F,0xFF,0xF0,0x0F,0xFF,0x0F,0x84,0xFF,0x06,0xF0,0xFF,0xFF,0xFC,0x0F,0xFF,0x0F,0x84,0xFF,0x06,0xF0,0x3F,0xFF,0xFF,0xC0,
+    0xFF,0xF0,0x85,0x00,0x04,0x03,0xFF,0xFF,0xFC,0x0F,0x89,0xFF,0x06,0xF0,0x3F,0xFF,0xF0,0x0F,0xFC,0x0F,0x84,0xFF,0x06,0xF0,
+    0x3F,0xFF,0xF0,0x0F,0xFC,0x0F,0x84,0xFF,0x06,0xF0,0x3F,0xFF,0xFF,0xC0,0xFF,0xF0,0x86,0x00,0x03,0xFF,0xFF,0xFC,0x0F,0x89,
+    0xFF,0x06,0xF0,0x3F,0xFF,0xF0,0x3F,0xF0,0x3F,0x84,0xFF,0x06,0xFC,0x0F,0xFF,0xF0,0x0F,0xFC,0x3F,0x84,0xFF,0x06,0xFC,0x0F,
+    0xFF,0xFF,0x00,0xFF,0xC0,0x86,0x00,0x03,0xFF,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0xC0,0x3F,0xF0,0x86,0xFF,0x04,
+    0x0F,0xFF,0xF0,0x3F,0xF0,0x86,0xFF,0x05,0x0F,0xFF,0xFF,0x03,0xFF,0xC0,0x86,0x00,0x03,0x3F,0xFF,0xFC,0x0F,0x89,0xFF,0x05,
+    0xF0,0x3F,0xFF,0xC0,0x3F,0xC0,0x86,0xFF,0x04,0x03,0xFF,0xC0,0x3F,0xF0,0x86,0xFF,0x04,0x03,0xFF,0xFF,0x03,0xFF,0x87,0x00,
+    0x03,0x3F,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0xC0,0xFF,0xC3,0x86,0xFF,0x04,0xC3,0xFF,0xC0,0x3F,0xF3,0x86,0xFF,
+    0x04,0xC3,0xFF,0xFC,0x03,0xFF,0x87,0x00,0x03,0x0F,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0xC0,0xFF,0xC3,0x86,0xFF,
+    0x04,0xC3,0xFF,0xC0,0x3F,0xC3,0x86,0xFF,0x04,0xC0,0xFF,0xFC,0x03,0xFF,0x87,0x00,0x03,0x0F,0xFF,0xFC,0x0F,0x89,0xFF,0x05,
+    0xF0,0x3F,0xFF,0xC0,0xFF,0xC3,0x86,0xFF,0x04,0xC3,0xFF,0xC0,0xFF,0xC3,0x86,0xFF,0x04,0xC0,0xFF,0xFC,0x03,0xFC,0x87,0x00,
+    0x03,0x0F,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0x00,0xFF,0x03,0x86,0xFF,0x04,0xC0,0xFF,0xC0,0xFF,0xC3,0x86,0xFF,
+    0x04,0xC0,0xFF,0xFC,0x0F,0xFC,0x87,0x00,0x03,0x0F,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0x00,0xFF,0x0F,0x86,0xFF,
+    0x04,0xF0,0xFF,0xC0,0xFF,0xCF,0x86,0xFF,0x04,0xF0,0xFF,0xFC,0x0F,0xFC,0x87,0x00,0x03,0x03,0xFF,0xFC,0x0F,0x89,0xFF,0x05,
+    0xF0,0x3F,0xFF,0x00,0xFF,0x0F,0x86,0xFF,0x04,0xF0,0xFF,0xC0,0xFF,0xCF,0x86,0xFF,0x04,0xF0,0xFF,0xFC,0x0F,0xFC,0x87,0x00,
+    0x03,0x03,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0x00,0xFF,0x0F,0x86,0xFF,0x04,0xF0,0xFF,0xC0,0xFF,0x0F,0x86,0xFF,
+    0x06,0xF0,0xFF,0xFC,0x0F,0xFC,0x00,0x0F,0x85,0x00,0x03,0x03,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0x00,0xFF,0x0F,
+    0x86,0xFF,0x04,0xF0,0xFF,0xC0,0xFF,0x0F,0x86,0xFF,0x06,0xF0,0xFF,0xFC,0x0F,0xFC,0x00,0x0F,0x85,0x00,0x03,0x03,0xFF,0xFC,
+    0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0x00,0xFF,0x0F,0x86,0xFF,0x04,0xF0,0xFF,0xC0,0xFF,0x0F,0x86,0xFF,0x06,0xF0,0xFF,0xFC,
+    0x0F,0xFC,0x00,0x0F,0x85,0x00,0x03,0x03,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0x00,0xFF,0x0F,0x86,0xFF,0x04,0xF0,
+    0xFF,0xC0,0xFF,0x0F,0x86,0xFF,0x07,0xF0,0xFF,0xFC,0x0F,0xFC,0x00,0x0F,0xC0,0x84,0x00,0x03,0x03,0xFF,0xFC,0x0F,0x89,0xFF,
+    0x05,0xF0,0x3F,0xFF,0x00,0xFF,0x0F,0x86,0xFF,0x04,0xF0,0xFF,0xC0,0xFF,0xCF,0x86,0xFF,0x07,0xF0,0xFF,0xFC,0x0F,0xFC,0x00,
+    0x03,0xC0,0x84,0x00,0x03,0x03,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0x00,0xFF,0x0F,0x86,0xFF,0x04,0xF0,0xFF,0xC0,
+    0xFF,0xCF,0x86,0xFF,0x07,0xF0,0xFF,0xFC,0x0F,0xFC,0x00,0x03,0xC0,0x84,0x00,0x03,0x0F,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,
+    0x3F,0xFF,0x00,0xFF,0x03,0x86,0xFF,0x04,0xC0,0xFF,0xC0,0xFF,0xC3,0x86,0xFF,0x07,0xC0,0xFF,0xFC,0x0F,0xFC,0x00,0x03,0xF0,
+    0x84,0x00,0x03,0x0F,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0xC0,0xFF,0xC3,0x86,0xFF,0x04,0xC3,0xFF,0xC0,0xFF,0xC3,
+    0x86,0xFF,0x07,0xC0,0xFF,0xFC,0x03,0xFC,0x00,0x00,0xF0,0x84,0x00,0x03,0x0F,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,
+    0xC0,0xFF,0xC3,0x86,0xFF,0x04,0xC3,0xFF,0xC0,0x3F,0xC3,0x86,0xFF,0x07,0xC3,0xFF,0xFC,0x03,0xFF,0x00,0x00,0xFC,0x84,0x00,
+    0x03,0x0F,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0xC0,0xFF,0xC3,0x86,0xFF,0x04,0xC3,0xFF,0xC0,0x3F,0xF3,0x86,0xFF,
+    0x07,0xC3,0xFF,0xFC,0x03,0xFF,0x00,0x00,0x3F,0x84,0x00,0x03,0x0F,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0xC0,0x3F,
+    0xF0,0x86,0xFF,0x04,0x0F,0xFF,0xF0,0x3F,0xF0,0x86,0xFF,0x08,0x03,0xFF,0xFF,0x03,0xFF,0x00,0x00,0x0F,0xC0,0x83,0x00,0x03,
+    0x3F,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0xC0,0x3F,0xF0,0x86,0xFF,0x04,0x0F,0xFF,0xF0,0x3F,0xFC,0x86,0xFF,0x08,
+    0x0F,0xFF,0xFF,0x03,0xFF,0xC0,0x00,0x03,0xFC,0x83,0x00,0x03,0x3F,0xFF,0xFC,0x0F,0x89,0xFF,0x06,0xF0,0x3F,0xFF,0xF0,0x3F,
+    0xFC,0x3F,0x84,0xFF,0x06,0xFC,0x3F,0xFF,0xF0,0x0F,0xFC,0x3F,0x84,0xFF,0x0A,0xFC,0x0F,0xFF,0xFF,0x00,0xFF,0xC0,0x00,0x00,
+    0xFF,0xC0,0x82,0x00,0x03,0xFF,0xFF,0xFC,0x0F,0x89,0xFF,0x06,0xF0,0x3F,0xFF,0xF0,0x0F,0xFC,0x0F,0x84,0xFF,0x06,0xF0,0x3F,
+    0xFF,0xF0,0x0F,0xFF,0x0F,0x84,0xFF,0x0A,0xF0,0x3F,0xFF,0xFF,0xC0,0xFF,0xF0,0x00,0x00,0x0F,0xFF,0x82,0x00,0x03,0xFF,0xFF,
+    0xFC,0x0F,0x89,0xFF,0x06,0xF0,0x3F,0xFF,0xF0,0x0F,0xFF,0x0F,0x84,0xFF,0x06,0xF0,0xFF,0xFF,0xFC,0x0F,0xFF,0x0F,0x84,0xFF,
+    0x00,0xF0,0x80,0xFF,0x02,0xC0,0x3F,0xF0,0x80,0x00,0x01,0xFF,0xC0,0x80,0x00,0x04,0x03,0xFF,0xFF,0xFC,0x0F,0x89,0xFF,0x06,
+    0xF0,0x3F,0xFF,0xFC,0x03,0xFF,0xC3,0x84,0xFF,0x06,0xC3,0xFF,0xFF,0xFC,0x03,0xFF,0xC3,0x84,0xFF,0x00,0xC0,0x80,0xFF,0x02,
+    0xC0,0x3F,0xFC,0x85,0x00,0x04,0x0F,0xFF,0xFF,0xFC,0x0F,0x89,0xFF,0x06,0xF0,0x3F,0xFF,0xFC,0x03,0xFF,0xC0,0x84,0xFF,0x06,
+    0x03,0xFF,0xFF,0xFC,0x00,0xFF,0xF0,0x84,0xFF,0x00,0x03,0x80,0xFF,0x02,0xF0,0x0F,0xFF,0x85,0x00,0x04,0x3F,0xFF,0xFF,0xFC,
+    0x0F,0x89,0xFF,0x07,0xF0,0x3F,0xFF,0xFF,0x00,0xFF,0xF0,0x3F,0x82,0xFF,0x01,0xFC,0x0F,0x80,0xFF,0x03,0x00,0xFF,0xFC,0x3F,
+    0x82,0xFF,0x01,0xFC,0x0F,0x80,0xFF,0x03,0xF0,0x0F,0xFF,0xC0,0x84,0x00,0x80,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x07,0xF0,0x3F,
+    0xFF,0xFF,0x00,0xFF,0xFC,0x03,0x82,0xFF,0x01,0xC0,0x3F,0x80,0xFF,0x03,0xC0,0x3F,0xFF,0x03,0x82,0xFF,0x01,0xC0,0x3F,0x80,
+    0xFF,0x03,0xFC,0x03,0xFF,0xF0,0x83,0x00,0x00,0x03,0x80,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x07,0xF0,0x3F,0xFF,0xFF,0xC0,0x3F,
+    0xFF,0xC0,0x82,0xFF,0x00,0x03,0x81,0xFF,0x03,0xC0,0x0F,0xFF,0xC0,0x82,0xFF,0x00,0x00,0x82,0xFF,0x02,0x00,0xFF,0xFC,0x83,
+    0x00,0x00,0x0F,0x80,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x08,0xF0,0x3F,0xFF,0xFF,0xF0,0x0F,0xFF,0xF0,0x0F,0x80,0xFF,0x01,0xF0,
+    0x0F,0x81,0xFF,0x04,0xF0,0x03,0xFF,0xF0,0x0F,0x80,0xFF,0x01,0xF0,0x0F,0x82,0xFF,0x03,0x00,0x3F,0xFF,0xC0,0x82,0x00,0x00,
+    0x3F,0x80,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x0C,0xF0,0x3F,0xFF,0xFF,0xF0,0x03,0xFF,0xFF,0x00,0x0F,0xFF,0xF0,0x00,0x82,0xFF,
+    0x09,0xFC,0x00,0xFF,0xFF,0x00,0x0F,0xFF,0xF0,0x00,0x3F,0x82,0xFF,0x03,0xC0,0x0F,0xFF,0xF0,0x81,0x00,0x00,0x03,0x81,0xFF,
+    0x01,0xFC,0x0F,0x89,0xFF,0x08,0xF0,0x3F,0xFF,0xFF,0xFC,0x00,0x3F,0xFF,0xF0,0x80,0x00,0x00,0x0F,0x83,0xFF,0x03,0x00,0x3F,
+    0xFF,0xF0,0x80,0x00,0x00,0x03,0x83,0xFF,0x03,0xF0,0x03,0xFF,0xFF,0x81,0x00,0x00,0x3F,0x81,0xFF,0x01,0xFC,0x0F,0x89,0xFF,
+    0x01,0xF0,0x3F,0x80,0xFF,0x06,0xC0,0x0F,0xFF,0xFF,0xC0,0x00,0x03,0x84,0xFF,0x06,0xC0,0x0F,0xFF,0xFF,0xC0,0x00,0x03,0x84,
+    0xFF,0x07,0xFC,0x00,0x3F,0xFF,0xFF,0x00,0x00,0x0F,0x82,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,
+    0x00,0x89,0xFF,0x02,0xF0,0x00,0x3F,0x89,0xFF,0x01,0x00,0x03,0x87,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x80,0xFF,
+    0x02,0xFC,0x00,0x03,0x88,0xFF,0x02,0xFC,0x00,0x03,0x89,0xFF,0x02,0xC0,0x00,0x3F,0x86,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,
+    0xF0,0x3F,0x81,0xFF,0x02,0xC0,0x00,0x0F,0x88,0xFF,0x02,0xC0,0x00,0x0F,0x88,0xFF,0x03,0xFC,0x00,0x00,0x3F,0x85,0xFF,0x01,
+    0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x81,0xFF,0x03,0xF0,0x00,0x00,0x0F,0x87,0xFF,0x03,0xFC,0x00,0x00,0x0F,0x88,0xFF,0x02,
+    0xC0,0x00,0x00,0x85,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x82,0xFF,0x02,0x00,0x00,0x0F,0x88,0xFF,0x02,0xC0,0x00,
+    0x0F,0x88,0xFF,0x02,0xFC,0x00,0x00,0x85,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x82,0xFF,0x02,0xFC,0x00,0x0F,0x89,
+    0xFF,0x01,0x00,0x0F,0x89,0xFF,0x01,0xF0,0x00,0x85,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xFC,0x0F,
+    0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,
+    0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,
+    0xF0,0x0F,0x89,0xFF,0x01,0xF0,0x0F,0xA9,0xFF,0x01,0xF0,0x3F,0x89,0xFF,0x01,0xFC,0x03,0xA9,0xFF,0x01,0xC0,0x3F,0x89,0xFF,
+    0x01,0xFC,0x00,0xA8,0xFF,0x01,0xFC,0x00,0x8B,0xFF,0xAB,0x00,0x8B,0xFF,0x00,0xC0,0xA9,0x00,0x00,0x0F,0x8B,0xFF,0x00,0xFC,
+    0xA9,0x00,0x00,0x3F,0x8D,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x03,0x85,0xFF,0x00,0x00,0x81,0xFF,0x01,0xC0,0x3F,0x84,
+    0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x03,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x0F,0x85,0xFF,0x00,0x00,0x81,
+    0xFF,0x00,0xC0,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x03,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x0F,0x85,
+    0xFF,0x00,0x00,0x81,0xFF,0x00,0xC0,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x03,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,
+    0x01,0xFC,0x0F,0x85,0xFF,0x00,0x00,0x81,0xFF,0x00,0xC0,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x0F,0x95,0xFF,0x01,
+    0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x0F,0x85,0xFF,0x00,0x00,0x81,0xFF,0x00,0xC0,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,
+    0x0F,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x0F,0x85,0xFF,0x00,0x00,0x81,0xFF,0x00,0x00,0x85,0xFF,0x01,0xF0,0x3F,
+    0x80,0xFF,0x01,0xF0,0x0F,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x3F,0x85,0xFF,0x00,0x00,0x81,0xFF,0x00,0x03,0x85,
+    0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x0F,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xC0,0x3F,0x85,0xFF,0x00,0x00,0x80,
+    0xFF,0x01,0xFC,0x03,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x3F,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x00,0xC0,0x86,
+    0xFF,0x00,0x00,0x80,0xFF,0x01,0xFC,0x03,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xC0,0x3F,0x95,0xFF,0x01,0xF0,0x3F,0x80,
+    0xFF,0x00,0x00,0x86,0xFF,0x00,0x00,0x80,0xFF,0x01,0xF0,0x0F,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x00,0xC0,0x96,0xFF,0x01,
+    0xF0,0x3F,0x80,0xFF,0x00,0x00,0x86,0xFF,0x00,0x00,0x80,0xFF,0x01,0xF0,0x3F,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x00,0x00,
+    0x96,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xFC,0x03,0x86,0xFF,0x00,0x00,0x80,0xFF,0x01,0xC0,0x3F,0x85,0xFF,0x05,0xF0,0x3F,0xFF,
+    0xFF,0xFC,0x03,0x96,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xF0,0x0F,0x86,0xFF,0x00,0x00,0x80,0xFF,0x00,0x00,0x86,0xFF,0x05,0xF0,
+    0x3F,0xFF,0xFF,0xF0,0x03,0x96,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xC0,0x3F,0x86,0xFF,0x04,0x00,0xFF,0xFF,0xFC,0x00,0x86,0xFF,
+    0x05,0xF0,0x3F,0xFF,0xFF,0xC0,0x0F,0x96,0xFF,0x05,0xF0,0x3F,0xFF,0xFC,0x00,0x3F,0x86,0xFF,0x04,0x00,0xFF,0xFF,0xC0,0x03,
+    0x86,0xFF,0x05,0xF0,0x3F,0xFF,0xFC,0x00,0x3F,0x96,0xFF,0x04,0xF0,0x3F,0xFF,0xC0,0x03,0x87,0xFF,0x04,0x00,0xFF,0xFC,0x00,
+    0x3F,0x86,0xFF,0x04,0xF0,0x3F,0xFF,0xC0,0x00,0x97,0xFF,0x04,0xF0,0x3F,0xF0,0x00,0x0F,0x87,0xFF,0x03,0x00,0xFF,0x00,0x00,
+    0x87,0xFF,0x04,0xF0,0x3F,0xF0,0x00,0x0F,0x97,0xFF,0x00,0xF0,0x80,0x00,0x88,0xFF,0x80,0x00,0x00,0x03,0x87,0xFF,0x00,0xF0,
+    0x80,0x00,0x00,0x3F,0x97,0xFF,0x03,0xF0,0x00,0x00,0x03,0x88,0xFF,0x80,0x00,0x00,0x3F,0x87,0xFF,0x03,0xF0,0x00,0x00,0x03,
+    0x98,0xFF,0x02,0xFC,0x00,0x00,0x89,0xFF,0x02,0xC0,0x00,0x0F,0x88,0xFF,0x02,0xFC,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x90,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,0xFF,0x02,0xC0,0x00,0x3F,0xB5,0xFF,0x00,0xC0,0x80,0x00,0x00,0x3F,0xB3,0xFF,
+    0x00,0xFC,0x81,0x00,0x00,0x03,0xB3,0xFF,0x00,0xF0,0x82,0x00,0xB3,0xFF,0x83,0x00,0x00,0x0F,0xB1,0xFF,0x00,0xFC,0x83,0x00,
+    0x00,0x03,0xB1,0xFF,0x00,0xF0,0x84,0x00,0xB1,0xFF,0x00,0xC0,0x84,0x00,0x00,0x3F,0xB0,0xFF,0x00,0xC0,0x84,0x00,0x00,0x3F,
+    0xB0,0xFF,0x85,0x00,0x00,0x0F,0xAF,0xFF,0x00,0xFC,0x85,0x00,0x00,0x03,0xAF,0xFF,0x00,0xFC,0x85,0x00,0x00,0x03,0xAF,0xFF,
+    0x00,0xF0,0x86,0x00,0xAF,0xFF,0x00,0xF0,0x86,0x00,0xAF,0xFF,0x00,0xF0,0x86,0x00,0xAF,0xFF,0x00,0xF0,0x86,0x00,0xAF,0xFF,
+    0x00,0xC0,0x86,0x00,0x00,0x3F,0xAE,0xFF,0x00,0xC0,0x86,0x00,0x00,0x3F,0xAE,0xFF,0x01,0xC0,0x0F,0x85,0x00,0x00,0x3F,0xAE,
+    0xFF,0x01,0xC0,0x0F,0x85,0x00,0x00,0x3F,0xAE,0xFF,0x01,0xC0,0x0F,0x85,0x00,0x00,0x3F,0xAE,0xFF,0x02,0xC0,0x0F,0xC0,0x84,
+    0x00,0x00,0x3F,0xAE,0xFF,0x02,0xC0,0x03,0xC0,0x84,0x00,0x00,0x3F,0xAE,0xFF,0x02,0xC0,0x03,0xC0,0x84,0x00,0x00,0x3F,0xAE,
+    0xFF,0x02,0xF0,0x03,0xF0,0x84,0x00,0xAF,0xFF,0x02,0xF0,0x00,0xF0,0x84,0x00,0xAF,0xFF,0x02,0xF0,0x00,0xFC,0x84,0x00,0xAF,
+    0xFF,0x02,0xF0,0x00,0x3F,0x84,0x00,0xAF,0xFF,0x03,0xFC,0x00,0x0F,0xC0,0x82,0x00,0x00,0x03,0xAF,0xFF,0x03,0xFC,0x00,0x03,
+    0xFC,0x82,0x00,0x00,0x03,0xB0,0xFF,0x03,0x00,0x00,0xFF,0xC0,0x81,0x00,0x00,0x0F,0xB0,0xFF,0x03,0xC0,0x00,0x0F,0xFF,0x81,
+    0x00,0x00,0x3F,0xB0,0xFF,0x04,0xC0,0x00,0x00,0xFF,0xC0,0x80,0x00,0x00,0x3F,0xB0,0xFF,0x00,0xF0,0x84,0x00,0xB1,0xFF,0x00,
+    0xFC,0x83,0x00,0x00,0x03,0xB2,0xFF,0x83,0x00,0x00,0x0F,0xB2,0xFF,0x00,0xF0,0x82,0x00,0xB3,0xFF,0x00,0xFC,0x81,0x00,0x00,
+    0x03,0xB4,0xFF,0x00,0xC0,0x80,0x00,0x00,0x3F,0xB5,0xFF,0x02,0xC0,0x00,0x3F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0xFF,0x02,0xFC,0x00,0x03,0x89,0xFF,0x02,0xC0,0x00,0x3F,0x88,0xFF,0x02,0xFC,0x00,0x03,0x99,
+    0xFF,0x03,0xF0,0x00,0x00,0x0F,0x88,0xFF,0x80,0x00,0x88,0xFF,0x03,0xF0,0x00,0x00,0x0F,0x98,0xFF,0x00,0xF0,0x80,0x00,0x88,
+    0xFF,0x80,0x00,0x00,0x0F,0x87,0xFF,0x00,0xF0,0x80,0x00,0x98,0xFF,0x04,0xF0,0x3F,0xF0,0x00,0x0F,0x87,0xFF,0x03,0x00,0xFF,
+    0x00,0x00,0x87,0xFF,0x04,0xF0,0x3F,0xF0,0x00,0x0F,0x97,0xFF,0x04,0xF0,0x3F,0xFF,0xC0,0x03,0x87,0xFF,0x04,0x00,0xFF,0xFC,
+    0x00,0x3F,0x86,0xFF,0x04,0xF0,0x3F,0xFF,0xC0,0x00,0x97,0xFF,0x04,0xF0,0x3F,0xFF,0xFC,0x00,0x87,0xFF,0x04,0x00,0xFF,0xFF,
+    0xC0,0x0F,0x86,0xFF,0x05,0xF0,0x3F,0xFF,0xFC,0x00,0x3F,0x96,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xC0,0x3F,0x86,0xFF,0x04,0x00,
+    0xFF,0xFF,0xFC,0x03,0x86,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xC0,0x0F,0x96,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xF0,0x0F,0x86,0xFF,
+    0x00,0x00,0x80,0xFF,0x00,0x00,0x86,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xF0,0x0F,0x96,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xFC,0x03,
+    0x86,0xFF,0x00,0x00,0x80,0xFF,0x01,0xC0,0x3F,0x85,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xFC,0x03,0x96,0xFF,0x01,0xF0,0x3F,0x80,
+    0xFF,0x00,0x03,0x86,0xFF,0x00,0x00,0x80,0xFF,0x01,0xF0,0x3F,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x00,0x00,0x96,0xFF,0x01,
+    0xF0,0x3F,0x80,0xFF,0x00,0x00,0x86,0xFF,0x00,0x00,0x80,0xFF,0x01,0xF0,0x0F,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x00,0xC0,
+    0x96,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x00,0xC0,0x86,0xFF,0x00,0x00,0x80,0xFF,0x01,0xFC,0x03,0x85,0xFF,0x01,0xF0,0x3F,0x80,
+    0xFF,0x01,0xC0,0x3F,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xC0,0x3F,0x85,0xFF,0x00,0x00,0x80,0xFF,0x01,0xFC,0x03,0x85,
+    0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x3F,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x3F,0x85,0xFF,0x00,0x00,0x81,
+    0xFF,0x00,0x03,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x0F,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x0F,0x85,
+    0xFF,0x00,0x00,0x81,0xFF,0x00,0x00,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x0F,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,
+    0x01,0xF0,0x0F,0x85,0xFF,0x00,0x00,0x81,0xFF,0x00,0xC0,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x0F,0x95,0xFF,0x01,
+    0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x0F,0x85,0xFF,0x00,0x00,0x81,0xFF,0x00,0xC0,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,
+    0x0F,0x95,0xFF,0x00,0xF0,0x9F,0x00,0x00,0x03,0x93,0xFF,0x00,0xFC,0xA9,0x00,0x00,0x3F,0x8B,0xFF,0x00,0xC0,0xA9,0x00,0x00,
+    0x03,0x8B,0xFF,0xAB,0x00,0x8A,0xFF,0x01,0xFC,0x00,0xA9,0xFF,0x01,0x00,0x3F,0x89,0xFF,0x01,0xFC,0x0F,0xA9,0xFF,0x01,0xC0,
+    0x3F,0x89,0xFF,0x01,0xF0,0x0F,0xA9,0xFF,0x01,0xF0,0x3F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xF0,0x0F,0x89,0xFF,0x01,
+    0xF0,0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,
+    0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,
+    0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x84,0xFF,0x00,0x3F,0x8A,0xFF,0x00,0x0F,0x8A,0xFF,
+    0x00,0xF0,0x85,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x82,0xFF,0x02,0xFC,0x00,0x03,0x88,0xFF,0x02,0xFC,0x00,0x03,
+    0x89,0xFF,0x02,0xF0,0x00,0x3F,0x84,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x82,0xFF,0x02,0x00,0x00,0x03,0x88,0xFF,
+    0x02,0xC0,0x00,0x03,0x88,0xFF,0x03,0xFC,0x00,0x00,0x0F,0x84,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x81,0xFF,0x03,
+    0xFC,0x00,0x00,0x0F,0x87,0xFF,0x03,0xFC,0x00,0x00,0x0F,0x88,0xFF,0x03,0xC0,0x00,0x00,0x3F,0x84,0xFF,0x01,0xFC,0x0F,0x89,
+    0xFF,0x01,0xF0,0x3F,0x81,0xFF,0x02,0x00,0x00,0x0F,0x88,0xFF,0x02,0xC0,0x00,0x0F,0x88,0xFF,0x02,0xFC,0x00,0x00,0x86,0xFF,
+    0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x02,0xFC,0x00,0x03,0x88,0xFF,0x02,0xFC,0x00,0x03,0x89,0xFF,0x02,0xC0,
+    0x00,0x3F,0x86,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x00,0x89,0xFF,0x01,0xF0,0x00,0x8A,0xFF,
+    0x01,0x00,0x03,0x87,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x03,0x00,0x0F,0xFF,0xFF,0x80,0x00,0x84,0xFF,
+    0x03,0xC0,0x0F,0xFF,0xFF,0x80,0x00,0x84,0xFF,0x07,0xFC,0x00,0x3F,0xFF,0xFC,0x00,0x00,0x03,0x82,0xFF,0x01,0xFC,0x0F,0x89,
+    0xFF,0x08,0xF0,0x3F,0xFF,0xFF,0xFC,0x00,0x3F,0xFF,0xC0,0x80,0x00,0x00,0x03,0x83,0xFF,0x03,0x00,0x3F,0xFF,0xC0,0x80,0x00,
+    0x00,0x03,0x83,0xFF,0x03,0xF0,0x03,0xFF,0xFF,0x81,0x00,0x00,0x0F,0x81,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x07,0xF0,0x3F,0xFF,
+    0xFF,0xF0,0x03,0xFF,0xFC,0x82,0x00,0x00,0x3F,0x81,0xFF,0x09,0xFC,0x00,0xFF,0xFC,0x00,0x0F,0xFF,0xF0,0x00,0x3F,0x82,0xFF,
+    0x08,0xC0,0x0F,0xFF,0xF0,0x00,0x3F,0xFF,0xC0,0x00,0x81,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x07,0xF0,0x3F,0xFF,0xFF,0xF0,0x0F,
+    0xFF,0xF0,0x82,0x00,0x00,0x0F,0x81,0xFF,0x04,0xF0,0x03,0xFF,0xF0,0x0F,0x80,0xFF,0x01,0xF0,0x03,0x82,0xFF,0x04,0x00,0x3F,
+    0xFF,0x00,0x3F,0x80,0xFF,0x01,0xC0,0x3F,0x80,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x06,0xF0,0x3F,0xFF,0xFF,0xC0,0x3F,0xFF,0x84,
+    0x00,0x81,0xFF,0x03,0xC0,0x0F,0xFF,0xC0,0x82,0xFF,0x00,0x00,0x82,0xFF,0x03,0x00,0xFF,0xFC,0x03,0x81,0xFF,0x01,0xFC,0x0F,
+    0x80,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x06,0xF0,0x3F,0xFF,0xFF,0x00,0xFF,0xFC,0x84,0x00,0x00,0x3F,0x80,0xFF,0x03,0xC0,0x3F,
+    0xFC,0x03,0x82,0xFF,0x01,0xC0,0x3F,0x80,0xFF,0x04,0xFC,0x03,0xFF,0xF0,0x0F,0x82,0xFF,0x00,0x00,0x80,0xFF,0x01,0xFC,0x0F,
+    0x89,0xFF,0x06,0xF0,0x3F,0xFF,0xFF,0x00,0xFF,0xF0,0x84,0x00,0x00,0x0F,0x80,0xFF,0x03,0x00,0xFF,0xF0,0x3F,0x82,0xFF,0x01,
+    0xFC,0x0F,0x80,0xFF,0x03,0xF0,0x0F,0xFF,0xC0,0x83,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xFC,0x0F,0x89,0xFF,0x06,0xF0,0x3F,0xFF,
+    0xFC,0x03,0xFF,0xC0,0x84,0x00,0x00,0x03,0x80,0xFF,0x02,0x00,0xFF,0xF0,0x84,0xFF,0x00,0x03,0x80,0xFF,0x03,0xF0,0x0F,0xFF,
+    0x03,0x83,0xFF,0x05,0xFC,0x0F,0xFF,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0xFC,0x03,0xFF,0x86,0x00,0x05,0xFF,0xFF,
+    0xFC,0x03,0xFF,0xC3,0x84,0xFF,0x00,0xC0,0x80,0xFF,0x03,0xC0,0x3F,0xFC,0x0F,0x84,0xFF,0x04,0x0F,0xFF,0xFF,0xFC,0x0F,0x89,
+    0xFF,0x05,0xF0,0x3F,0xFF,0xF0,0x0F,0xFF,0x86,0x00,0x05,0xFF,0xFF,0xFC,0x0F,0xFF,0x0F,0x84,0xFF,0x07,0xF0,0x3F,0xFF,0xFF,
+    0xC0,0xFF,0xF0,0x3F,0x84,0xFF,0x04,0xC3,0xFF,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0xF0,0x0F,0xFC,0x86,0x00,0x05,
+    0x3F,0xFF,0xF0,0x0F,0xFC,0x0F,0x84,0xFF,0x07,0xF0,0x3F,0xFF,0xFF,0xC0,0xFF,0xF0,0x3F,0x84,0xFF,0x04,0xC0,0xFF,0xFF,0xFC,
+    0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0xF0,0x3F,0xF0,0x86,0x00,0x05,0x0F,0xFF,0xF0,0x0F,0xFC,0x3F,0x84,0xFF,0x06,0xFC,0x0F,
+    0xFF,0xFF,0x00,0xFF,0xC0,0x85,0xFF,0x04,0xF0,0xFF,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0xC0,0x3F,0xF0,0x86,0x00,
+    0x04,0x0F,0xFF,0xF0,0x3F,0xF0,0x86,0xFF,0x05,0x0F,0xFF,0xFF,0x03,0xFF,0xC3,0x85,0xFF,0x04,0xFC,0x3F,0xFF,0xFC,0x0F,0x89,
+    0xFF,0x05,0xF0,0x3F,0xFF,0xC0,0x3F,0xC0,0x86,0x00,0x04,0x03,0xFF,0xC0,0x3F,0xF0,0x86,0xFF,0x05,0x03,0xFF,0xFF,0x03,0xFF,
+    0x03,0x85,0xFF,0x04,0xFC,0x3F,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0xC0,0xFF,0xC0,0x86,0x00,0x04,0x03,0xFF,0xC0,
+    0x3F,0xF3,0x86,0xFF,0x05,0xC3,0xFF,0xFC,0x03,0xFF,0x0F,0x86,0xFF,0x03,0x0F,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,
+    0xC0,0xFF,0xC0,0x86,0x00,0x04,0x03,0xFF,0xC0,0x3F,0xC3,0x86,0xFF,0x05,0xC0,0xFF,0xFC,0x03,0xFF,0x0F,0x86,0xFF,0x03,0x0F,
+    0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0xC0,0xFF,0xC0,0x86,0x00,0x04,0x03,0xFF,0xC0,0xFF,0xC3,0x86,0xFF,0x05,0xC0,
+    0xFF,0xFC,0x03,0xFC,0x0F,0x86,0xFF,0x03,0x0F,0xFF,0xFC,0x0F,0x89,0xFF,0x04,0xF0,0x3F,0xFF,0x00,0xFF,0x88,0x00,0x03,0xFF,
+    0xC0,0xFF,0xC3,0x86,0xFF,0x05,0xC0,0xFF,0xFC,0x0F,0xFC,0x0F,0x86,0xFF,0x03,0x0F,0xFF,0xFC,0x0F,0x89,0xFF,0x04,0xF0,0x3F,
+    0xFF,0x00,0xFF,0x88,0x00,0x03,0xFF,0xC0,0xFF,0xCF,0x86,0xFF,0x05,0xF0,0xFF,0xFC,0x0F,0xFC,0x3F,0x86,0xFF,0x03,0xC3,0xFF,
+    0xFC,0x0F,0x89,0xFF,0x04,0xF0,0x3F,0xFF,0x00,0xFF,0x88,0x00,0x03,0xFF,0xC0,0xFF,0xCF,0x86,0xFF,0x05,0xF0,0xFF,0xFC,0x0F,
+    0xFC,0x3F,0x86,0xFF,0x03,0xC3,0xFF,0xFC,0x0F,0x89,0xFF,0x07,0xF0,0x3F,0xFF,0x00,0xFF,0x00,0x00,0xF0,0x85,0x00,0x03,0xFF,
+    0xC0,0xFF,0x0F,0x86,0xFF,0x05,0xF0,0xFF,0xFC,0x0F,0xFC,0x3F,0x86,0xFF,0x03,0xC3,0xFF,0xFC,0x0F,0x89,0xFF,0x07,0xF0,0x3F,
+    0xFF,0x00,0xFF,0x00,0x00,0xF0,0x85,0x00,0x03,0xFF,0xC0,0xFF,0x0F,0x86,0xFF,0x05,0xF0,0xFF,0xFC,0x0F,0xFC,0x3F,0x86,0xFF,
+    0x03,0xC3,0xFF,0xFC,0x0F,0x89,0xFF,0x07,0xF0,0x3F,0xFF,0x00,0xFF,0x00,0x00,0xF0,0x85,0x00,0x03,0xFF,0xC0,0xFF,0x0F,0x86,
+    0xFF,0x05,0xF0,0xFF,0xFC,0x0F,0xFC,0x3F,0x86,0xFF,0x03,0xC3,0xFF,0xFC,0x0F,0x89,0xFF,0x07,0xF0,0x3F,0xFF,0x00,0xFF,0x00,
+    0x00,0xF0,0x85,0x00,0x03,0xFF,0xC0,0xFF,0x0F,0x86,0xFF,0x05,0xF0,0xFF,0xFC,0x0F,0xFC,0x3F,0x86,0xFF,0x03,0xC3,0xFF,0xFC,
+    0x0F,0x89,0xFF,0x07,0xF0,0x3F,0xFF,0x00,0xFF,0x00,0x00,0xF0,0x85,0x00,0x03,0xFF,0xC0,0xFF,0xCF,0x86,0xFF,0x05,0xF0,0xFF,
+    0xFC,0x0F,0xFC,0x3F,0x86,0xFF,0x03,0xC3,0xFF,0xFC,0x0F,0x89,0xFF,0x07,0xF0,0x3F,0xFF,0x00,0xFF,0x00,0x00,0xFC,0x85,0x00,
+    0x03,0xFF,0xC0,0xFF,0xCF,0x86,0xFF,0x05,0xF0,0xFF,0xFC,0x0F,0xFC,0x3F,0x86,0xFF,0x03,0xCF,0xFF,0xFC,0x0F,0x89,0xFF,0x07,
+    0xF0,0x3F,0xFF,0x00,0xFF,0x00,0x00,0x3C,0x85,0x00,0x03,0xFF,0xC0,0xFF,0xC3,0x86,0xFF,0x05,0xC0,0xFF,0xFC,0x0F,0xFC,0x0F,
+    0x86,0xFF,0x03,0x0F,0xFF,0xFC,0x0F,0x89,0xFF,0x07,0xF0,0x3F,0xFF,0xC0,0xFF,0xC0,0x00,0x3F,0x84,0x00,0x04,0x03,0xFF,0xC0,
+    0xFF,0xC3,0x86,0xFF,0x05,0xC0,0xFF,0xFC,0x03,0xFC,0x0F,0x86,0xFF,0x03,0x0F,0xFF,0xFC,0x0F,0x89,0xFF,0x07,0xF0,0x3F,0xFF,
+    0xC0,0xFF,0xC0,0x00,0x0F,0x84,0x00,0x04,0x03,0xFF,0xC0,0x3F,0xC3,0x86,0xFF,0x05,0xC3,0xFF,0xFC,0x03,0xFF,0x0F,0x86,0xFF,
+    0x03,0x0F,0xFF,0xFC,0x0F,0x89,0xFF,0x08,0xF0,0x3F,0xFF,0xC0,0xFF,0xC0,0x00,0x03,0xC0,0x83,0x00,0x04,0x03,0xFF,0xC0,0x3F,
+    0xF3,0x86,0xFF,0x05,0xC3,0xFF,0xFC,0x03,0xFF,0x0F,0x86,0xFF,0x03,0x0F,0xFF,0xFC,0x0F,0x89,0xFF,0x08,0xF0,0x3F,0xFF,0xC0,
+    0x3F,0xF0,0x00,0x03,0xFC,0x83,0x00,0x04,0x0F,0xFF,0xF0,0x3F,0xF0,0x86,0xFF,0x05,0x03,0xFF,0xFF,0x03,0xFF,0x03,0x85,0xFF,
+    0x04,0xFC,0x3F,0xFF,0xFC,0x0F,0x89,0xFF,0x08,0xF0,0x3F,0xFF,0xC0,0x3F,0xF0,0x00,0x00,0xFF,0x83,0x00,0x04,0x0F,0xFF,0xF0,
+    0x3F,0xFC,0x86,0xFF,0x05,0x0F,0xFF,0xFF,0x03,0xFF,0xC3,0x85,0xFF,0x04,0xFC,0x3F,0xFF,0xFC,0x0F,0x89,0xFF,0x09,0xF0,0x3F,
+    0xFF,0xF0,0x3F,0xFC,0x00,0x00,0x0F,0xFC,0x82,0x00,0x05,0x3F,0xFF,0xF0,0x0F,0xFC,0x3F,0x84,0xFF,0x06,0xFC,0x0F,0xFF,0xFF,
+    0x00,0xFF,0xC0,0x85,0xFF,0x04,0xF0,0xFF,0xFF,0xFC,0x0F,0x89,0xFF,0x0A,0xF0,0x3F,0xFF,0xF0,0x0F,0xFC,0x00,0x00,0x03,0xFF,
+    0xF0,0x81,0x00,0x05,0x3F,0xFF,0xF0,0x0F,0xFF,0x0F,0x84,0xFF,0x07,0xF0,0x3F,0xFF,0xFF,0xC0,0xFF,0xF0,0x3F,0x84,0xFF,0x04,
+    0xC0,0xFF,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0xF0,0x0F,0xFF,0x80,0x00,0x01,0x3F,0xF0,0x81,0x00,0x05,0xFF,0xFF,
+    0xFC,0x0F,0xFF,0x0F,0x84,0xFF,0x00,0xF0,0x80,0xFF,0x03,0xC0,0x3F,0xF0,0x3F,0x84,0xFF,0x04,0xC3,0xFF,0xFF,0xFC,0x0F,0x89,
+    0xFF,0x06,0xF0,0x3F,0xFF,0xFC,0x03,0xFF,0xC0,0x84,0x00,0x06,0x03,0xFF,0xFF,0xFC,0x03,0xFF,0xC3,0x84,0xFF,0x00,0xC0,0x80,
+    0xFF,0x03,0xC0,0x3F,0xFC,0x0F,0x84,0xFF,0x04,0x0F,0xFF,0xFF,0xFC,0x0F,0x89,0xFF,0x06,0xF0,0x3F,0xFF,0xFC,0x03,0xFF,0xC0,
+    0x84,0x00,0x06,0x03,0xFF,0xFF,0xFC,0x00,0xFF,0xF0,0x84,0xFF,0x00,0x03,0x80,0xFF,0x03,0xF0,0x0F,0xFF,0x03,0x83,0xFF,0x05,
+    0xFC,0x3F,0xFF,0xFF,0xFC,0x0F,0x89,0xFF,0x06,0xF0,0x3F,0xFF,0xFF,0x00,0xFF,0xF0,0x84,0x00,0x00,0x0F,0x80,0xFF,0x03,0x00,
+    0xFF,0xFC,0x3F,0x82,0xFF,0x01,0xFC,0x0F,0x80,0xFF,0x03,0xF0,0x0F,0xFF,0xC0,0x83,0xFF,0x00,0xF0,0x80,0xFF,0x01,0xFC,0x0F,
+    0x89,0xFF,0x06,0xF0,0x3F,0xFF,0xFF,0x00,0xFF,0xFC,0x84,0x00,0x00,0x3F,0x80,0xFF,0x03,0xC0,0x3F,0xFF,0x03,0x82,0xFF,0x01,
+    0xC0,0x3F,0x80,0xFF,0x04,0xFC,0x03,0xFF,0xF0,0x0F,0x82,0xFF,0x00,0x03,0x80,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x07,0xF0,0x3F,
+    0xFF,0xFF,0xC0,0x3F,0xFF,0xC0,0x82,0x00,0x00,0x03,0x81,0xFF,0x03,0xC0,0x0F,0xFF,0xC0,0x82,0xFF,0x00,0x00,0x82,0xFF,0x03,
+    0x00,0xFF,0xFC,0x03,0x81,0xFF,0x01,0xFC,0x0F,0x80,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x07,0xF0,0x3F,0xFF,0xFF,0xF0,0x0F,0xFF,
+    0xF0,0x82,0x00,0x00,0x0F,0x81,0xFF,0x04,0xF0,0x03,0xFF,0xF0,0x0F,0x80,0xFF,0x01,0xF0,0x0F,0x82,0xFF,0x04,0x00,0x3F,0xFF,
+    0xC0,0x3F,0x80,0xFF,0x01,0xC0,0x3F,0x80,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x07,0xF0,0x3F,0xFF,0xFF,0xF0,0x03,0xFF,0xFF,0x82,
+    0x00,0x82,0xFF,0x09,0xFC,0x00,0xFF,0xFF,0x00,0x0F,0xFF,0xF0,0x00,0x3F,0x82,0xFF,0x08,0xC0,0x0F,0xFF,0xF0,0x00,0x3F,0xFF,
+    0xC0,0x03,0x81,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x08,0xF0,0x3F,0xFF,0xFF,0xFC,0x00,0x3F,0xFF,0xF0,0x80,0x00,0x00,0x0F,0x83,
+    0xFF,0x03,0x00,0x3F,0xFF,0xF0,0x80,0x00,0x00,0x03,0x83,0xFF,0x03,0xF0,0x03,0xFF,0xFF,0x81,0x00,0x00,0x3F,0x81,0xFF,0x01,
+    0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x06,0xC0,0x0F,0xFF,0xFF,0xC0,0x00,0x03,0x84,0xFF,0x06,0xC0,0x0F,0xFF,0xFF,
+    0xC0,0x00,0x03,0x84,0xFF,0x07,0xFC,0x00,0x3F,0xFF,0xFF,0x00,0x00,0x0F,0x82,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,
+    0x80,0xFF,0x01,0xF0,0x00,0x89,0xFF,0x02,0xF0,0x00,0x3F,0x89,0xFF,0x01,0x00,0x03,0x87,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,
+    0xF0,0x3F,0x80,0xFF,0x02,0xFC,0x00,0x03,0x88,0xFF,0x02,0xFC,0x00,0x03,0x89,0xFF,0x02,0xC0,0x00,0x3F,0x86,0xFF,0x01,0xFC,
+    0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x81,0xFF,0x02,0xC0,0x00,0x0F,0x88,0xFF,0x02,0xC0,0x00,0x0F,0x88,0xFF,0x03,0xFC,0x00,0x00,
+    0x3F,0x85,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x81,0xFF,0x03,0xF0,0x00,0x00,0x0F,0x87,0xFF,0x03,0xFC,0x00,0x00,
+    0x0F,0x88,0xFF,0x02,0xC0,0x00,0x00,0x85,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x82,0xFF,0x02,0x00,0x00,0x0F,0x88,
+    0xFF,0x02,0xC0,0x00,0x0F,0x88,0xFF,0x02,0xFC,0x00,0x00,0x85,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x82,0xFF,0x02,
+    0xFC,0x00,0x0F,0x89,0xFF,0x01,0x00,0x0F,0x89,0xFF,0x01,0xF0,0x00,0x85,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,
+    0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xFC,0x0F,
+    0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,
+    0x3F,0xA9,0xFF,0x01,0xF0,0x0F,0x89,0xFF,0x01,0xF0,0x0F,0xA9,0xFF,0x01,0xF0,0x3F,0x89,0xFF,0x01,0xFC,0x03,0xA9,0xFF,0x01,
+    0xC0,0x3F,0x89,0xFF,0x01,0xFC,0x00,0xA8,0xFF,0x01,0xFC,0x00,0x8B,0xFF,0xAB,0x00,0x8B,0xFF,0x00,0xC0,0xA9,0x00,0x00,0x0F,
+    0x8B,0xFF,0x00,0xFC,0xA9,0x00,0x00,0x3F,0x8D,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x03,0x85,0xFF,0x00,0x00,0x81,0xFF,
+    0x01,0xC0,0x3F,0x84,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x03,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x0F,0x85,
+    0xFF,0x00,0x00,0x81,0xFF,0x00,0xC0,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x03,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,
+    0x01,0xFC,0x0F,0x85,0xFF,0x00,0x00,0x81,0xFF,0x00,0xC0,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x03,0x95,0xFF,0x01,
+    0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x0F,0x85,0xFF,0x00,0x00,0x81,0xFF,0x00,0xC0,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,
+    0x0F,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x0F,0x85,0xFF,0x00,0x00,0x81,0xFF,0x00,0xC0,0x85,0xFF,0x01,0xF0,0x3F,
+    0x80,0xFF,0x01,0xFC,0x0F,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x0F,0x85,0xFF,0x00,0x00,0x81,0xFF,0x00,0x00,0x85,
+    0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x0F,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x3F,0x85,0xFF,0x00,0x00,0x81,
+    0xFF,0x00,0x03,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x0F,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xC0,0x3F,0x85,
+    0xFF,0x00,0x00,0x80,0xFF,0x01,0xFC,0x03,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x3F,0x95,0xFF,0x01,0xF0,0x3F,0x80,
+    0xFF,0x00,0xC0,0x86,0xFF,0x00,0x00,0x80,0xFF,0x01,0xFC,0x03,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xC0,0x3F,0x95,0xFF,
+    0x01,0xF0,0x3F,0x80,0xFF,0x00,0x00,0x86,0xFF,0x00,0x00,0x80,0xFF,0x01,0xF0,0x0F,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x00,
+    0xC0,0x96,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x00,0x00,0x86,0xFF,0x00,0x00,0x80,0xFF,0x01,0xF0,0x3F,0x85,0xFF,0x01,0xF0,0x3F,
+    0x80,0xFF,0x00,0x00,0x96,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xFC,0x03,0x86,0xFF,0x00,0x00,0x80,0xFF,0x01,0xC0,0x3F,0x85,0xFF,
+    0x05,0xF0,0x3F,0xFF,0xFF,0xFC,0x03,0x96,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xF0,0x0F,0x86,0xFF,0x00,0x00,0x80,0xFF,0x00,0x00,
+    0x86,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xF0,0x03,0x96,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xC0,0x3F,0x86,0xFF,0x04,0x00,0xFF,0xFF,
+    0xFC,0x00,0x86,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xC0,0x0F,0x96,0xFF,0x05,0xF0,0x3F,0xFF,0xFC,0x00,0x3F,0x86,0xFF,0x04,0x00,
+    0xFF,0xFF,0xC0,0x03,0x86,0xFF,0x05,0xF0,0x3F,0xFF,0xFC,0x00,0x3F,0x96,0xFF,0x04,0xF0,0x3F,0xFF,0xC0,0x03,0x87,0xFF,0x04,
+    0x00,0xFF,0xFC,0x00,0x3F,0x86,0xFF,0x04,0xF0,0x3F,0xFF,0xC0,0x00,0x97,0xFF,0x04,0xF0,0x3F,0xF0,0x00,0x0F,0x87,0xFF,0x03,
+    0x00,0xFF,0x00,0x00,0x87,0xFF,0x04,0xF0,0x3F,0xF0,0x00,0x0F,0x97,0xFF,0x00,0xF0,0x80,0x00,0x88,0xFF,0x80,0x00,0x00,0x03,
+    0x87,0xFF,0x00,0xF0,0x80,0x00,0x00,0x3F,0x97,0xFF,0x03,0xF0,0x00,0x00,0x03,0x88,0xFF,0x80,0x00,0x00,0x3F,0x87,0xFF,0x03,
+    0xF0,0x00,0x00,0x03,0x98,0xFF,0x02,0xFC,0x00,0x00,0x89,0xFF,0x02,0xC0,0x00,0x0F,0x88,0xFF,0x02,0xFC,0x00,0x00,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x90,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC8,0xFF,0x02,0xF0,0x00,0x0F,0xB5,0xFF,0x00,0xF0,0x80,0x00,
+    0x00,0x0F,0xB4,0xFF,0x82,0x00,0xB3,0xFF,0x00,0xFC,0x82,0x00,0x00,0x3F,0xB2,0xFF,0x00,0xC0,0x82,0x00,0x00,0x03,0xB2,0xFF,
+    0x84,0x00,0xB1,0xFF,0x00,0xFC,0x84,0x00,0x00,0x3F,0xB0,0xFF,0x00,0xF0,0x84,0x00,0x00,0x0F,0xB0,0xFF,0x00,0xF0,0x84,0x00,
+    0x00,0x0F,0xB0,0xFF,0x00,0xC0,0x84,0x00,0x00,0x03,0xB0,0xFF,0x86,0x00,0xB0,0xFF,0x86,0x00,0xAF,0xFF,0x00,0xFC,0x86,0x00,
+    0x00,0x3F,0xAE,0xFF,0x00,0xFC,0x86,0x00,0x00,0x3F,0xAE,0xFF,0x00,0xFC,0x86,0x00,0x00,0x3F,0xAE,0xFF,0x00,0xFC,0x86,0x00,
+    0x00,0x3F,0xAE,0xFF,0x00,0xF0,0x86,0x00,0x00,0x0F,0xAE,0xFF,0x00,0xF0,0x86,0x00,0x00,0x0F,0xAE,0xFF,0x02,0xF0,0x00,0xF0,
+    0x84,0x00,0x00,0x0F,0xAE,0xFF,0x02,0xF0,0x00,0xF0,0x84,0x00,0x00,0x0F,0xAE,0xFF,0x02,0xF0,0x00,0xF0,0x84,0x00,0x00,0x0F,
+    0xAE,0xFF,0x02,0xF0,0x00,0xF0,0x84,0x00,0x00,0x0F,0xAE,0xFF,0x02,0xF0,0x00,0xF0,0x84,0x00,0x00,0x0F,0xAE,0xFF,0x02,0xF0,
+    0x00,0xFC,0x84,0x00,0x00,0x0F,0xAE,0xFF,0x02,0xFC,0x00,0x3C,0x84,0x00,0x00,0x3F,0xAE,0xFF,0x02,0xFC,0x00,0x3F,0x84,0x00,
+    0x00,0x3F,0xAE,0xFF,0x02,0xFC,0x00,0x0F,0x84,0x00,0x00,0x3F,0xAE,0xFF,0x03,0xFC,0x00,0x03,0xC0,0x83,0x00,0x00,0x3F,0xAF,
+    0xFF,0x02,0x00,0x03,0xFC,0x83,0x00,0xB0,0xFF,0x02,0x00,0x00,0xFF,0x83,0x00,0xB0,0xFF,0x03,0xC0,0x00,0x0F,0xFC,0x81,0x00,
+    0x00,0x03,0xB0,0xFF,0x04,0xF0,0x00,0x03,0xFF,0xF0,0x80,0x00,0x00,0x0F,0xB0,0xFF,0x04,0xF0,0x00,0x00,0x3F,0xF0,0x80,0x00,
+    0x00,0x0F,0xB0,0xFF,0x00,0xFC,0x84,0x00,0x00,0x3F,0xB1,0xFF,0x84,0x00,0xB2,0xFF,0x00,0xC0,0x82,0x00,0x00,0x03,0xB2,0xFF,
+    0x00,0xFC,0x82,0x00,0x00,0x3F,0xB3,0xFF,0x82,0x00,0xB4,0xFF,0x00,0xF0,0x80,0x00,0x00,0x0F,0xB5,0xFF,0x02,0xF0,0x00,0x0F,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xE3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0xFF,0x02,0xFC,0x00,0x03,0x89,0xFF,0x02,0xC0,
+    0x00,0x3F,0x88,0xFF,0x02,0xFC,0x00,0x03,0x99,0xFF,0x03,0xF0,0x00,0x00,0x0F,0x88,0xFF,0x80,0x00,0x88,0xFF,0x03,0xF0,0x00,
+    0x00,0x0F,0x98,0xFF,0x00,0xF0,0x80,0x00,0x88,0xFF,0x80,0x00,0x00,0x0F,0x87,0xFF,0x00,0xF0,0x80,0x00,0x98,0xFF,0x04,0xF0,
+    0x3F,0xF0,0x00,0x0F,0x87,0xFF,0x03,0x00,0xFF,0x00,0x00,0x87,0xFF,0x04,0xF0,0x3F,0xF0,0x00,0x0F,0x97,0xFF,0x04,0xF0,0x3F,
+    0xFF,0xC0,0x03,0x87,0xFF,0x04,0x00,0xFF,0xFC,0x00,0x3F,0x86,0xFF,0x04,0xF0,0x3F,0xFF,0xC0,0x00,0x97,0xFF,0x04,0xF0,0x3F,
+    0xFF,0xFC,0x00,0x87,0xFF,0x04,0x00,0xFF,0xFF,0xC0,0x0F,0x86,0xFF,0x05,0xF0,0x3F,0xFF,0xFC,0x00,0x3F,0x96,0xFF,0x05,0xF0,
+    0x3F,0xFF,0xFF,0xC0,0x3F,0x86,0xFF,0x04,0x00,0xFF,0xFF,0xFC,0x03,0x86,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xC0,0x0F,0x96,0xFF,
+    0x05,0xF0,0x3F,0xFF,0xFF,0xF0,0x0F,0x86,0xFF,0x00,0x00,0x80,0xFF,0x00,0x00,0x86,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xF0,0x0F,
+    0x96,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xFC,0x03,0x86,0xFF,0x00,0x00,0x80,0xFF,0x01,0xC0,0x3F,0x85,0xFF,0x05,0xF0,0x3F,0xFF,
+    0xFF,0xFC,0x03,0x96,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x00,0x03,0x86,0xFF,0x00,0x00,0x80,0xFF,0x01,0xF0,0x3F,0x85,0xFF,0x01,
+    0xF0,0x3F,0x80,0xFF,0x00,0x00,0x96,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x00,0x00,0x86,0xFF,0x00,0x00,0x80,0xFF,0x01,0xF0,0x0F,
+    0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x00,0xC0,0x96,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x00,0xC0,0x86,0xFF,0x00,0x00,0x80,0xFF,
+    0x01,0xFC,0x03,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xC0,0x3F,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xC0,0x3F,0x85,
+    0xFF,0x00,0x00,0x80,0xFF,0x01,0xFC,0x03,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x3F,0x95,0xFF,0x01,0xF0,0x3F,0x80,
+    0xFF,0x01,0xF0,0x3F,0x85,0xFF,0x00,0x00,0x81,0xFF,0x00,0x03,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x0F,0x95,0xFF,
+    0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x0F,0x85,0xFF,0x00,0x00,0x81,0xFF,0x00,0x00,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,
+    0xF0,0x0F,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x0F,0x85,0xFF,0x00,0x00,0x81,0xFF,0x00,0xC0,0x85,0xFF,0x01,0xF0,
+    0x3F,0x80,0xFF,0x01,0xFC,0x0F,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x0F,0x85,0xFF,0x00,0x00,0x81,0xFF,0x00,0xC0,
+    0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x0F,0x95,0xFF,0x00,0xF0,0x9F,0x00,0x00,0x03,0x93,0xFF,0x00,0xFC,0xA9,0x00,
+    0x00,0x3F,0x8B,0xFF,0x00,0xC0,0xA9,0x00,0x00,0x03,0x8B,0xFF,0xAB,0x00,0x8A,0xFF,0x01,0xFC,0x00,0xA9,0xFF,0x01,0x00,0x3F,
+    0x89,0xFF,0x01,0xFC,0x0F,0xA9,0xFF,0x01,0xC0,0x3F,0x89,0xFF,0x01,0xF0,0x0F,0xA9,0xFF,0x01,0xF0,0x3F,0x89,0xFF,0x01,0xF0,
+    0x3F,0xA9,0xFF,0x01,0xF0,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,
+    0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,0xFF,
+    0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x84,
+    0xFF,0x00,0x3F,0x8A,0xFF,0x00,0x0F,0x8A,0xFF,0x00,0xF0,0x85,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x82,0xFF,0x02,
+    0xFC,0x00,0x03,0x88,0xFF,0x02,0xFC,0x00,0x03,0x89,0xFF,0x02,0xF0,0x00,0x3F,0x84,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,
+    0x3F,0x82,0xFF,0x02,0x00,0x00,0x03,0x88,0xFF,0x02,0xC0,0x00,0x03,0x88,0xFF,0x03,0xFC,0x00,0x00,0x0F,0x84,0xFF,0x01,0xFC,
+    0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x81,0xFF,0x03,0xFC,0x00,0x00,0x0F,0x87,0xFF,0x03,0xFC,0x00,0x00,0x0F,0x88,0xFF,0x03,0xC0,
+    0x00,0x00,0x3F,0x84,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x81,0xFF,0x02,0x00,0x00,0x0F,0x88,0xFF,0x02,0xC0,0x00,
+    0x0F,0x88,0xFF,0x02,0xFC,0x00,0x00,0x86,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x02,0xFC,0x00,0x03,0x88,
+    0xFF,0x02,0xFC,0x00,0x03,0x89,0xFF,0x02,0xC0,0x00,0x3F,0x86,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,
+    0xF0,0x00,0x89,0xFF,0x01,0xF0,0x00,0x8A,0xFF,0x01,0x00,0x03,0x87,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x80,0xFF,
+    0x03,0x00,0x0F,0xFF,0xFF,0x80,0x00,0x84,0xFF,0x03,0xC0,0x0F,0xFF,0xFF,0x80,0x00,0x84,0xFF,0x07,0xFC,0x00,0x3F,0xFF,0xFC,
+    0x00,0x00,0x03,0x82,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x08,0xF0,0x3F,0xFF,0xFF,0xFC,0x00,0x3F,0xFF,0xC0,0x80,0x00,0x00,0x03,
+    0x83,0xFF,0x03,0x00,0x3F,0xFF,0xC0,0x80,0x00,0x00,0x03,0x83,0xFF,0x03,0xF0,0x03,0xFF,0xFF,0x81,0x00,0x00,0x0F,0x81,0xFF,
+    0x01,0xFC,0x0F,0x89,0xFF,0x07,0xF0,0x3F,0xFF,0xFF,0xF0,0x03,0xFF,0xFC,0x82,0x00,0x00,0x3F,0x81,0xFF,0x03,0xFC,0x00,0xFF,
+    0xFC,0x82,0x00,0x00,0x3F,0x82,0xFF,0x03,0xC0,0x0F,0xFF,0xF0,0x82,0x00,0x81,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x07,0xF0,0x3F,
+    0xFF,0xFF,0xF0,0x0F,0xFF,0xF0,0x82,0x00,0x00,0x0F,0x81,0xFF,0x03,0xF0,0x03,0xFF,0xF0,0x82,0x00,0x00,0x03,0x82,0xFF,0x02,
+    0x00,0x3F,0xFF,0x83,0x00,0x00,0x3F,0x80,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x06,0xF0,0x3F,0xFF,0xFF,0xC0,0x3F,0xFF,0x84,0x00,
+    0x81,0xFF,0x03,0xC0,0x0F,0xFF,0xC0,0x83,0x00,0x82,0xFF,0x02,0x00,0xFF,0xFC,0x83,0x00,0x00,0x0F,0x80,0xFF,0x01,0xFC,0x0F,
+    0x89,0xFF,0x06,0xF0,0x3F,0xFF,0xFF,0x00,0xFF,0xFC,0x84,0x00,0x00,0x3F,0x80,0xFF,0x02,0xC0,0x3F,0xFC,0x84,0x00,0x00,0x3F,
+    0x80,0xFF,0x03,0xFC,0x03,0xFF,0xF0,0x84,0x00,0x80,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x06,0xF0,0x3F,0xFF,0xFF,0x00,0xFF,0xF0,
+    0x84,0x00,0x00,0x0F,0x80,0xFF,0x02,0x00,0xFF,0xF0,0x84,0x00,0x00,0x0F,0x80,0xFF,0x03,0xF0,0x0F,0xFF,0xC0,0x84,0x00,0x04,
+    0x3F,0xFF,0xFF,0xFC,0x0F,0x89,0xFF,0x06,0xF0,0x3F,0xFF,0xFC,0x03,0xFF,0xC0,0x84,0x00,0x00,0x03,0x80,0xFF,0x02,0x00,0xFF,
+    0xF0,0x84,0x00,0x00,0x03,0x80,0xFF,0x02,0xF0,0x0F,0xFF,0x85,0x00,0x04,0x0F,0xFF,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,
+    0xFF,0xFC,0x03,0xFF,0x86,0x00,0x05,0xFF,0xFF,0xFC,0x03,0xFF,0xC0,0x85,0x00,0x80,0xFF,0x02,0xC0,0x3F,0xFC,0x85,0x00,0x04,
+    0x0F,0xFF,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0xF0,0x0F,0xFF,0x86,0x00,0x04,0xFF,0xFF,0xFC,0x0F,0xFF,0x86,0x00,
+    0x05,0x3F,0xFF,0xFF,0xC0,0xFF,0xF0,0x85,0x00,0x04,0x03,0xFF,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0xF0,0x0F,0xFC,
+    0x86,0x00,0x04,0x3F,0xFF,0xF0,0x0F,0xFC,0x86,0x00,0x05,0x3F,0xFF,0xFF,0xC0,0xFF,0xF0,0x86,0x00,0x03,0xFF,0xFF,0xFC,0x0F,
+    0x89,0xFF,0x05,0xF0,0x3F,0xFF,0xF0,0x3F,0xF0,0x86,0x00,0x04,0x0F,0xFF,0xF0,0x0F,0xFC,0x86,0x00,0x05,0x0F,0xFF,0xFF,0x00,
+    0xFF,0xC0,0x86,0x00,0x03,0xFF,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0xC0,0x3F,0xF0,0x86,0x00,0x04,0x0F,0xFF,0xF0,
+    0x3F,0xF0,0x86,0x00,0x05,0x0F,0xFF,0xFF,0x03,0xFF,0xC0,0x86,0x00,0x03,0x3F,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,
+    0xC0,0x3F,0xC0,0x86,0x00,0x04,0x03,0xFF,0xC0,0x3F,0xF0,0x86,0x00,0x04,0x03,0xFF,0xFF,0x03,0xFF,0x87,0x00,0x03,0x3F,0xFF,
+    0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0xC0,0xFF,0xC0,0x86,0x00,0x04,0x03,0xFF,0xC0,0x3F,0xF0,0x86,0x00,0x04,0x03,0xFF,
+    0xFC,0x03,0xFF,0x87,0x00,0x03,0x0F,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0xC0,0xFF,0xC0,0x86,0x00,0x04,0x03,0xFF,
+    0xC0,0x3F,0xC0,0x87,0x00,0x03,0xFF,0xFC,0x03,0xFF,0x87,0x00,0x03,0x0F,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0xC0,
+    0xFF,0xC0,0x86,0x00,0x04,0x03,0xFF,0xC0,0xFF,0xC0,0x87,0x00,0x03,0xFF,0xFC,0x03,0xFC,0x87,0x00,0x03,0x0F,0xFF,0xFC,0x0F,
+    0x89,0xFF,0x04,0xF0,0x3F,0xFF,0x00,0xFF,0x88,0x00,0x03,0xFF,0xC0,0xFF,0xC0,0x87,0x00,0x03,0xFF,0xFC,0x0F,0xFC,0x87,0x00,
+    0x03,0x0F,0xFF,0xFC,0x0F,0x89,0xFF,0x04,0xF0,0x3F,0xFF,0x00,0xFF,0x88,0x00,0x03,0xFF,0xC0,0xFF,0xC0,0x87,0x00,0x03,0xFF,
+    0xFC,0x0F,0xFC,0x87,0x00,0x03,0x03,0xFF,0xFC,0x0F,0x89,0xFF,0x04,0xF0,0x3F,0xFF,0x00,0xFF,0x88,0x00,0x03,0xFF,0xC0,0xFF,
+    0xC0,0x87,0x00,0x03,0xFF,0xFC,0x0F,0xFC,0x87,0x00,0x03,0x03,0xFF,0xFC,0x0F,0x89,0xFF,0x07,0xF0,0x3F,0xFF,0x00,0xFF,0x00,
+    0x00,0xF0,0x85,0x00,0x05,0xFF,0xC0,0xFF,0x00,0x00,0xF0,0x85,0x00,0x05,0xFF,0xFC,0x0F,0xFC,0x00,0x0F,0x85,0x00,0x03,0x03,
+    0xFF,0xFC,0x0F,0x89,0xFF,0x07,0xF0,0x3F,0xFF,0x00,0xFF,0x00,0x00,0xF0,0x85,0x00,0x05,0xFF,0xC0,0xFF,0x00,0x00,0xF0,0x85,
+    0x00,0x05,0xFF,0xFC,0x0F,0xFC,0x00,0x0F,0x85,0x00,0x03,0x03,0xFF,0xFC,0x0F,0x89,0xFF,0x07,0xF0,0x3F,0xFF,0x00,0xFF,0x00,
+    0x00,0xF0,0x85,0x00,0x05,0xFF,0xC0,0xFF,0x00,0x00,0xF0,0x85,0x00,0x05,0xFF,0xFC,0x0F,0xFC,0x00,0x0F,0x85,0x00,0x03,0x03,
+    0xFF,0xFC,0x0F,0x89,0xFF,0x07,0xF0,0x3F,0xFF,0x00,0xFF,0x00,0x00,0xF0,0x85,0x00,0x05,0xFF,0xC0,0xFF,0x00,0x00,0xF0,0x85,
+    0x00,0x06,0xFF,0xFC,0x0F,0xFC,0x00,0x0F,0xC0,0x84,0x00,0x03,0x03,0xFF,0xFC,0x0F,0x89,0xFF,0x07,0xF0,0x3F,0xFF,0x00,0xFF,
+    0x00,0x00,0xF0,0x85,0x00,0x05,0xFF,0xC0,0xFF,0xC0,0x00,0xF0,0x85,0x00,0x06,0xFF,0xFC,0x0F,0xFC,0x00,0x03,0xC0,0x84,0x00,
+    0x03,0x03,0xFF,0xFC,0x0F,0x89,0xFF,0x07,0xF0,0x3F,0xFF,0x00,0xFF,0x00,0x00,0xFC,0x85,0x00,0x05,0xFF,0xC0,0xFF,0xC0,0x00,
+    0x3C,0x85,0x00,0x06,0xFF,0xFC,0x0F,0xFC,0x00,0x03,0xC0,0x84,0x00,0x03,0x0F,0xFF,0xFC,0x0F,0x89,0xFF,0x07,0xF0,0x3F,0xFF,
+    0x00,0xFF,0x00,0x00,0x3C,0x85,0x00,0x05,0xFF,0xC0,0xFF,0xC0,0x00,0x3C,0x85,0x00,0x06,0xFF,0xFC,0x0F,0xFC,0x00,0x03,0xF0,
+    0x84,0x00,0x03,0x0F,0xFF,0xFC,0x0F,0x89,0xFF,0x07,0xF0,0x3F,0xFF,0xC0,0xFF,0xC0,0x00,0x3F,0x84,0x00,0x06,0x03,0xFF,0xC0,
+    0xFF,0xC0,0x00,0x0F,0x85,0x00,0x06,0xFF,0xFC,0x03,0xFC,0x00,0x00,0xF0,0x84,0x00,0x03,0x0F,0xFF,0xFC,0x0F,0x89,0xFF,0x07,
+    0xF0,0x3F,0xFF,0xC0,0xFF,0xC0,0x00,0x0F,0x84,0x00,0x07,0x03,0xFF,0xC0,0x3F,0xC0,0x00,0x0F,0xC0,0x83,0x00,0x07,0x03,0xFF,
+    0xFC,0x03,0xFF,0x00,0x00,0xFC,0x84,0x00,0x03,0x0F,0xFF,0xFC,0x0F,0x89,0xFF,0x08,0xF0,0x3F,0xFF,0xC0,0xFF,0xC0,0x00,0x03,
+    0xC0,0x83,0x00,0x07,0x03,0xFF,0xC0,0x3F,0xF0,0x00,0x03,0xF0,0x83,0x00,0x07,0x03,0xFF,0xFC,0x03,0xFF,0x00,0x00,0x3F,0x84,
+    0x00,0x03,0x0F,0xFF,0xFC,0x0F,0x89,0xFF,0x08,0xF0,0x3F,0xFF,0xC0,0x3F,0xF0,0x00,0x03,0xFC,0x83,0x00,0x07,0x0F,0xFF,0xF0,
+    0x3F,0xF0,0x00,0x00,0xFC,0x83,0x00,0x08,0x03,0xFF,0xFF,0x03,0xFF,0x00,0x00,0x0F,0xC0,0x83,0x00,0x03,0x3F,0xFF,0xFC,0x0F,
+    0x89,0xFF,0x08,0xF0,0x3F,0xFF,0xC0,0x3F,0xF0,0x00,0x00,0xFF,0x83,0x00,0x07,0x0F,0xFF,0xF0,0x3F,0xFC,0x00,0x00,0x3F,0x83,
+    0x00,0x08,0x0F,0xFF,0xFF,0x03,0xFF,0xC0,0x00,0x03,0xFC,0x83,0x00,0x03,0x3F,0xFF,0xFC,0x0F,0x89,0xFF,0x09,0xF0,0x3F,0xFF,
+    0xF0,0x3F,0xFC,0x00,0x00,0x0F,0xFC,0x82,0x00,0x08,0x3F,0xFF,0xF0,0x0F,0xFC,0x00,0x00,0x0F,0xF0,0x82,0x00,0x09,0x0F,0xFF,
+    0xFF,0x00,0xFF,0xC0,0x00,0x00,0xFF,0xC0,0x82,0x00,0x03,0xFF,0xFF,0xFC,0x0F,0x89,0xFF,0x0A,0xF0,0x3F,0xFF,0xF0,0x0F,0xFC,
+    0x00,0x00,0x03,0xFF,0xF0,0x81,0x00,0x04,0x3F,0xFF,0xF0,0x0F,0xFF,0x80,0x00,0x01,0xFF,0xF0,0x81,0x00,0x09,0x3F,0xFF,0xFF,
+    0xC0,0xFF,0xF0,0x00,0x00,0x0F,0xFF,0x82,0x00,0x03,0xFF,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0xF0,0x0F,0xFF,0x80,
+    0x00,0x01,0x3F,0xF0,0x81,0x00,0x04,0xFF,0xFF,0xFC,0x0F,0xFF,0x80,0x00,0x01,0x0F,0xF0,0x81,0x00,0x80,0xFF,0x02,0xC0,0x3F,
+    0xF0,0x80,0x00,0x01,0xFF,0xC0,0x80,0x00,0x04,0x03,0xFF,0xFF,0xFC,0x0F,0x89,0xFF,0x06,0xF0,0x3F,0xFF,0xFC,0x03,0xFF,0xC0,
+    0x84,0x00,0x06,0x03,0xFF,0xFF,0xFC,0x03,0xFF,0xC0,0x85,0x00,0x80,0xFF,0x02,0xC0,0x3F,0xFC,0x85,0x00,0x04,0x0F,0xFF,0xFF,
+    0xFC,0x0F,0x89,0xFF,0x06,0xF0,0x3F,0xFF,0xFC,0x03,0xFF,0xC0,0x84,0x00,0x06,0x03,0xFF,0xFF,0xFC,0x00,0xFF,0xF0,0x84,0x00,
+    0x00,0x03,0x80,0xFF,0x02,0xF0,0x0F,0xFF,0x85,0x00,0x04,0x3F,0xFF,0xFF,0xFC,0x0F,0x89,0xFF,0x06,0xF0,0x3F,0xFF,0xFF,0x00,
+    0xFF,0xF0,0x84,0x00,0x00,0x0F,0x80,0xFF,0x02,0x00,0xFF,0xFC,0x84,0x00,0x00,0x0F,0x80,0xFF,0x03,0xF0,0x0F,0xFF,0xC0,0x84,
+    0x00,0x80,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x06,0xF0,0x3F,0xFF,0xFF,0x00,0xFF,0xFC,0x84,0x00,0x00,0x3F,0x80,0xFF,0x02,0xC0,
+    0x3F,0xFF,0x84,0x00,0x00,0x3F,0x80,0xFF,0x03,0xFC,0x03,0xFF,0xF0,0x83,0x00,0x00,0x03,0x80,0xFF,0x01,0xFC,0x0F,0x89,0xFF,
+    0x07,0xF0,0x3F,0xFF,0xFF,0xC0,0x3F,0xFF,0xC0,0x82,0x00,0x00,0x03,0x81,0xFF,0x03,0xC0,0x0F,0xFF,0xC0,0x83,0x00,0x82,0xFF,
+    0x02,0x00,0xFF,0xFC,0x83,0x00,0x00,0x0F,0x80,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x07,0xF0,0x3F,0xFF,0xFF,0xF0,0x0F,0xFF,0xF0,
+    0x82,0x00,0x00,0x0F,0x81,0xFF,0x03,0xF0,0x03,0xFF,0xF0,0x82,0x00,0x00,0x0F,0x82,0xFF,0x03,0x00,0x3F,0xFF,0xC0,0x82,0x00,
+    0x00,0x3F,0x80,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x07,0xF0,0x3F,0xFF,0xFF,0xF0,0x03,0xFF,0xFF,0x82,0x00,0x82,0xFF,0x03,0xFC,
+    0x00,0xFF,0xFF,0x82,0x00,0x00,0x3F,0x82,0xFF,0x03,0xC0,0x0F,0xFF,0xF0,0x81,0x00,0x00,0x03,0x81,0xFF,0x01,0xFC,0x0F,0x89,
+    0xFF,0x08,0xF0,0x3F,0xFF,0xFF,0xFC,0x00,0x3F,0xFF,0xF0,0x80,0x00,0x00,0x0F,0x83,0xFF,0x03,0x00,0x3F,0xFF,0xF0,0x80,0x00,
+    0x00,0x03,0x83,0xFF,0x03,0xF0,0x03,0xFF,0xFF,0x81,0x00,0x00,0x3F,0x81,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x80,
+    0xFF,0x06,0xC0,0x0F,0xFF,0xFF,0xC0,0x00,0x03,0x84,0xFF,0x06,0xC0,0x0F,0xFF,0xFF,0xC0,0x00,0x03,0x84,0xFF,0x07,0xFC,0x00,
+    0x3F,0xFF,0xFF,0x00,0x00,0x0F,0x82,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x00,0x89,0xFF,0x02,
+    0xF0,0x00,0x3F,0x89,0xFF,0x01,0x00,0x03,0x87,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x02,0xFC,0x00,0x03,
+    0x88,0xFF,0x02,0xFC,0x00,0x03,0x89,0xFF,0x02,0xC0,0x00,0x3F,0x86,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x81,0xFF,
+    0x02,0xC0,0x00,0x0F,0x88,0xFF,0x02,0xC0,0x00,0x0F,0x88,0xFF,0x03,0xFC,0x00,0x00,0x3F,0x85,0xFF,0x01,0xFC,0x0F,0x89,0xFF,
+    0x01,0xF0,0x3F,0x81,0xFF,0x03,0xF0,0x00,0x00,0x0F,0x87,0xFF,0x03,0xFC,0x00,0x00,0x0F,0x88,0xFF,0x02,0xC0,0x00,0x00,0x85,
+    0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x82,0xFF,0x02,0x00,0x00,0x0F,0x88,0xFF,0x02,0xC0,0x00,0x0F,0x88,0xFF,0x02,
+    0xFC,0x00,0x00,0x85,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x82,0xFF,0x02,0xFC,0x00,0x0F,0x89,0xFF,0x01,0x00,0x0F,
+    0x89,0xFF,0x01,0xF0,0x00,0x85,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,
+    0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,
+    0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xF0,0x0F,0x89,0xFF,
+    0x01,0xF0,0x0F,0xA9,0xFF,0x01,0xF0,0x3F,0x89,0xFF,0x01,0xFC,0x03,0xA9,0xFF,0x01,0xC0,0x3F,0x89,0xFF,0x01,0xFC,0x00,0xA8,
+    0xFF,0x01,0xFC,0x00,0x8B,0xFF,0xAB,0x00,0x8B,0xFF,0x00,0xC0,0xA9,0x00,0x00,0x0F,0x8B,0xFF,0x00,0xFC,0xA9,0x00,0x00,0x3F,
+    0x8D,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x03,0x85,0xFF,0x00,0x00,0x81,0xFF,0x01,0xC0,0x3F,0x84,0xFF,0x01,0xF0,0x3F,
+    0x80,0xFF,0x01,0xFC,0x03,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x0F,0x85,0xFF,0x00,0x00,0x81,0xFF,0x00,0xC0,0x85,
+    0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x03,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x0F,0x85,0xFF,0x00,0x00,0x81,
+    0xFF,0x00,0xC0,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x03,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x0F,0x85,
+    0xFF,0x00,0x00,0x81,0xFF,0x00,0xC0,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x0F,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,
+    0x01,0xF0,0x0F,0x85,0xFF,0x00,0x00,0x81,0xFF,0x00,0xC0,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x0F,0x95,0xFF,0x01,
+    0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x0F,0x85,0xFF,0x00,0x00,0x81,0xFF,0x00,0x00,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,
+    0x0F,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x3F,0x85,0xFF,0x00,0x00,0x81,0xFF,0x00,0x03,0x85,0xFF,0x01,0xF0,0x3F,
+    0x80,0xFF,0x01,0xF0,0x0F,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xC0,0x3F,0x85,0xFF,0x00,0x00,0x80,0xFF,0x01,0xFC,0x03,
+    0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x3F,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x00,0xC0,0x86,0xFF,0x00,0x00,0x80,
+    0xFF,0x01,0xFC,0x03,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xC0,0x3F,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x00,0x00,0x86,
+    0xFF,0x00,0x00,0x80,0xFF,0x01,0xF0,0x0F,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x00,0xC0,0x96,0xFF,0x01,0xF0,0x3F,0x80,0xFF,
+    0x00,0x00,0x86,0xFF,0x00,0x00,0x80,0xFF,0x01,0xF0,0x3F,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x00,0x00,0x96,0xFF,0x05,0xF0,
+    0x3F,0xFF,0xFF,0xFC,0x03,0x86,0xFF,0x00,0x00,0x80,0xFF,0x01,0xC0,0x3F,0x85,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xFC,0x03,0x96,
+    0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xF0,0x0F,0x86,0xFF,0x00,0x00,0x80,0xFF,0x00,0x00,0x86,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xF0,
+    0x03,0x96,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xC0,0x3F,0x86,0xFF,0x04,0x00,0xFF,0xFF,0xFC,0x00,0x86,0xFF,0x05,0xF0,0x3F,0xFF,
+    0xFF,0xC0,0x0F,0x96,0xFF,0x05,0xF0,0x3F,0xFF,0xFC,0x00,0x3F,0x86,0xFF,0x04,0x00,0xFF,0xFF,0xC0,0x03,0x86,0xFF,0x05,0xF0,
+    0x3F,0xFF,0xFC,0x00,0x3F,0x96,0xFF,0x04,0xF0,0x3F,0xFF,0xC0,0x03,0x87,0xFF,0x04,0x00,0xFF,0xFC,0x00,0x3F,0x86,0xFF,0x04,
+    0xF0,0x3F,0xFF,0xC0,0x00,0x97,0xFF,0x04,0xF0,0x3F,0xF0,0x00,0x0F,0x87,0xFF,0x03,0x00,0xFF,0x00,0x00,0x87,0xFF,0x04,0xF0,
+    0x3F,0xF0,0x00,0x0F,0x97,0xFF,0x00,0xF0,0x80,0x00,0x88,0xFF,0x80,0x00,0x00,0x03,0x87,0xFF,0x00,0xF0,0x80,0x00,0x00,0x3F,
+    0x97,0xFF,0x03,0xF0,0x00,0x00,0x03,0x88,0xFF,0x80,0x00,0x00,0x3F,0x87,0xFF,0x03,0xF0,0x00,0x00,0x03,0x98,0xFF,0x02,0xFC,
+    0x00,0x00,0x89,0xFF,0x02,0xC0,0x00,0x0F,0x88,0xFF,0x02,0xFC,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0x90,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xD6,0xFF,0x02,0xF0,0x00,0x0F,0x89,0xFF,0x02,0xC0,0x00,0x3F,0xA6,0xFF,0x00,0xF0,0x80,0x00,0x00,0x0F,
+    0x87,0xFF,0x00,0xC0,0x80,0x00,0x00,0x3F,0xA5,0xFF,0x82,0x00,0x86,0xFF,0x00,0xFC,0x81,0x00,0x00,0x03,0xA4,0xFF,0x00,0xFC,
+    0x82,0x00,0x00,0x3F,0x85,0xFF,0x00,0xF0,0x82,0x00,0xA4,0xFF,0x00,0xC0,0x82,0x00,0x00,0x03,0x85,0xFF,0x83,0x00,0x00,0x0F,
+    0xA3,0xFF,0x84,0x00,0x84,0xFF,0x00,0xFC,0x83,0x00,0x00,0x03,0xA2,0xFF,0x00,0xFC,0x84,0x00,0x00,0x3F,0x83,0xFF,0x00,0xF0,
+    0x84,0x00,0xA2,0xFF,0x00,0xF0,0x84,0x00,0x00,0x0F,0x83,0xFF,0x00,0xC0,0x84,0x00,0x00,0x3F,0xA1,0xFF,0x00,0xF0,0x84,0x00,
+    0x00,0x0F,0x83,0xFF,0x00,0xC0,0x84,0x00,0x00,0x3F,0xA1,0xFF,0x00,0xC0,0x84,0x00,0x00,0x03,0x83,0xFF,0x85,0x00,0x00,0x0F,
+    0xA1,0xFF,0x86,0x00,0x82,0xFF,0x00,0xFC,0x85,0x00,0x00,0x03,0xA1,0xFF,0x86,0x00,0x82,0xFF,0x00,0xFC,0x85,0x00,0x00,0x03,
+    0xA0,0xFF,0x00,0xFC,0x86,0x00,0x00,0x3F,0x81,0xFF,0x00,0xF0,0x86,0x00,0xA0,0xFF,0x00,0xFC,0x86,0x00,0x00,0x3F,0x81,0xFF,
+    0x00,0xF0,0x86,0x00,0xA0,0xFF,0x00,0xFC,0x86,0x00,0x00,0x3F,0x81,0xFF,0x00,0xF0,0x86,0x00,0xA0,0xFF,0x00,0xFC,0x86,0x00,
+    0x00,0x3F,0x81,0xFF,0x00,0xF0,0x86,0x00,0xA0,0xFF,0x00,0xF0,0x86,0x00,0x00,0x0F,0x81,0xFF,0x00,0xC0,0x86,0x00,0x00,0x3F,
+    0x9F,0xFF,0x00,0xF0,0x86,0x00,0x00,0x0F,0x81,0xFF,0x00,0xC0,0x86,0x00,0x00,0x3F,0x9F,0xFF,0x02,0xF0,0x00,0xF0,0x84,0x00,
+    0x00,0x0F,0x81,0xFF,0x01,0xC0,0x0F,0x85,0x00,0x00,0x3F,0x9F,0xFF,0x02,0xF0,0x00,0xF0,0x84,0x00,0x00,0x0F,0x81,0xFF,0x01,
+    0xC0,0x0F,0x85,0x00,0x00,0x3F,0x9F,0xFF,0x02,0xF0,0x00,0xF0,0x84,0x00,0x00,0x0F,0x81,0xFF,0x01,0xC0,0x0F,0x85,0x00,0x00,
+    0x3F,0x9F,0xFF,0x02,0xF0,0x00,0xF0,0x84,0x00,0x00,0x0F,0x81,0xFF,0x02,0xC0,0x0F,0xC0,0x84,0x00,0x00,0x3F,0x9F,0xFF,0x02,
+    0xF0,0x00,0xF0,0x84,0x00,0x00,0x0F,0x81,0xFF,0x02,0xC0,0x03,0xC0,0x84,0x00,0x00,0x3F,0x9F,0xFF,0x02,0xF0,0x00,0x3C,0x84,
+    0x00,0x00,0x0F,0x81,0xFF,0x02,0xC0,0x03,0xC0,0x84,0x00,0x00,0x3F,0x9F,0xFF,0x02,0xFC,0x00,0x3C,0x84,0x00,0x00,0x3F,0x81,
+    0xFF,0x02,0xF0,0x03,0xF0,0x84,0x00,0xA0,0xFF,0x02,0xFC,0x00,0x0F,0x84,0x00,0x00,0x3F,0x81,0xFF,0x02,0xF0,0x00,0xF0,0x84,
+    0x00,0xA0,0xFF,0x03,0xFC,0x00,0x0F,0xC0,0x83,0x00,0x00,0x3F,0x81,0xFF,0x02,0xF0,0x00,0xFC,0x84,0x00,0xA0,0xFF,0x03,0xFC,
+    0x00,0x03,0xF0,0x83,0x00,0x00,0x3F,0x81,0xFF,0x02,0xF0,0x00,0x3F,0x84,0x00,0xA1,0xFF,0x02,0x00,0x00,0xFC,0x83,0x00,0x82,
+    0xFF,0x03,0xFC,0x00,0x0F,0xC0,0x82,0x00,0x00,0x03,0xA1,0xFF,0x02,0x00,0x00,0x3F,0x83,0x00,0x82,0xFF,0x03,0xFC,0x00,0x03,
+    0xFC,0x82,0x00,0x00,0x03,0xA1,0xFF,0x03,0xC0,0x00,0x0F,0xF0,0x81,0x00,0x00,0x03,0x83,0xFF,0x03,0x00,0x00,0xFF,0xC0,0x81,
+    0x00,0x00,0x0F,0xA1,0xFF,0x04,0xF0,0x00,0x00,0xFF,0xF0,0x80,0x00,0x00,0x0F,0x83,0xFF,0x03,0xC0,0x00,0x0F,0xFF,0x81,0x00,
+    0x00,0x3F,0xA1,0xFF,0x04,0xF0,0x00,0x00,0x0F,0xF0,0x80,0x00,0x00,0x0F,0x83,0xFF,0x04,0xC0,0x00,0x00,0xFF,0xC0,0x80,0x00,
+    0x00,0x3F,0xA1,0xFF,0x00,0xFC,0x84,0x00,0x00,0x3F,0x83,0xFF,0x00,0xF0,0x84,0x00,0xA3,0xFF,0x84,0x00,0x84,0xFF,0x00,0xFC,
+    0x83,0x00,0x00,0x03,0xA3,0xFF,0x00,0xC0,0x82,0x00,0x00,0x03,0x85,0xFF,0x83,0x00,0x00,0x0F,0xA3,0xFF,0x00,0xFC,0x82,0x00,
+    0x00,0x3F,0x85,0xFF,0x00,0xF0,0x82,0x00,0xA5,0xFF,0x82,0x00,0x86,0xFF,0x00,0xFC,0x81,0x00,0x00,0x03,0xA5,0xFF,0x00,0xF0,
+    0x80,0x00,0x00,0x0F,0x87,0xFF,0x00,0xC0,0x80,0x00,0x00,0x3F,0xA6,0xFF,0x02,0xF0,0x00,0x0F,0x89,0xFF,0x02,0xC0,0x00,0x3F,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0xFF,0x02,0xFC,0x00,0x03,0x89,0xFF,0x02,0xC0,
+    0x00,0x3F,0x88,0xFF,0x02,0xFC,0x00,0x03,0x99,0xFF,0x03,0xF0,0x00,0x00,0x0F,0x88,0xFF,0x80,0x00,0x88,0xFF,0x03,0xF0,0x00,
+    0x00,0x0F,0x98,0xFF,0x00,0xF0,0x80,0x00,0x88,0xFF,0x80,0x00,0x00,0x0F,0x87,0xFF,0x00,0xF0,0x80,0x00,0x98,0xFF,0x04,0xF0,
+    0x3F,0xF0,0x00,0x0F,0x87,0xFF,0x03,0x00,0xFF,0x00,0x00,0x87,0xFF,0x04,0xF0,0x3F,0xF0,0x00,0x0F,0x97,0xFF,0x04,0xF0,0x3F,
+    0xFF,0xC0,0x03,0x87,0xFF,0x04,0x00,0xFF,0xFC,0x00,0x3F,0x86,0xFF,0x04,0xF0,0x3F,0xFF,0xC0,0x00,0x97,0xFF,0x04,0xF0,0x3F,
+    0xFF,0xFC,0x00,0x87,0xFF,0x04,0x00,0xFF,0xFF,0xC0,0x0F,0x86,0xFF,0x05,0xF0,0x3F,0xFF,0xFC,0x00,0x3F,0x96,0xFF,0x05,0xF0,
+    0x3F,0xFF,0xFF,0xC0,0x3F,0x86,0xFF,0x04,0x00,0xFF,0xFF,0xFC,0x03,0x86,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xC0,0x0F,0x96,0xFF,
+    0x05,0xF0,0x3F,0xFF,0xFF,0xF0,0x0F,0x86,0xFF,0x00,0x00,0x80,0xFF,0x00,0x00,0x86,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xF0,0x0F,
+    0x96,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xFC,0x03,0x86,0xFF,0x00,0x00,0x80,0xFF,0x01,0xC0,0x3F,0x85,0xFF,0x05,0xF0,0x3F,0xFF,
+    0xFF,0xFC,0x03,0x96,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x00,0x03,0x86,0xFF,0x00,0x00,0x80,0xFF,0x01,0xF0,0x3F,0x85,0xFF,0x01,
+    0xF0,0x3F,0x80,0xFF,0x00,0x00,0x96,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x00,0x00,0x86,0xFF,0x00,0x00,0x80,0xFF,0x01,0xF0,0x0F,
+    0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x00,0xC0,0x96,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x00,0xC0,0x86,0xFF,0x00,0x00,0x80,0xFF,
+    0x01,0xFC,0x03,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xC0,0x3F,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xC0,0x3F,0x85,
+    0xFF,0x00,0x00,0x80,0xFF,0x01,0xFC,0x03,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x3F,0x95,0xFF,0x01,0xF0,0x3F,0x80,
+    0xFF,0x01,0xF0,0x3F,0x85,0xFF,0x00,0x00,0x81,0xFF,0x00,0x03,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x0F,0x95,0xFF,
+    0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x0F,0x85,0xFF,0x00,0x00,0x81,0xFF,0x00,0x00,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,
+    0xF0,0x0F,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x0F,0x85,0xFF,0x00,0x00,0x81,0xFF,0x00,0xC0,0x85,0xFF,0x01,0xF0,
+    0x3F,0x80,0xFF,0x01,0xFC,0x0F,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x0F,0x85,0xFF,0x00,0x00,0x81,0xFF,0x00,0xC0,
+    0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x0F,0x95,0xFF,0x00,0xF0,0x9F,0x00,0x00,0x03,0x93,0xFF,0x00,0xFC,0xA9,0x00,
+    0x00,0x3F,0x8B,0xFF,0x00,0xC0,0xA9,0x00,0x00,0x03,0x8B,0xFF,0xAB,0x00,0x8A,0xFF,0x01,0xFC,0x00,0xA9,0xFF,0x01,0x00,0x3F,
+    0x89,0xFF,0x01,0xFC,0x0F,0xA9,0xFF,0x01,0xC0,0x3F,0x89,0xFF,0x01,0xF0,0x0F,0xA9,0xFF,0x01,0xF0,0x3F,0x89,0xFF,0x01,0xF0,
+    0x3F,0xA9,0xFF,0x01,0xF0,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,
+    0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,0xFF,
+    0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x84,
+    0xFF,0x00,0x3F,0x8A,0xFF,0x00,0x0F,0x8A,0xFF,0x00,0xF0,0x85,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x82,0xFF,0x02,
+    0xFC,0x00,0x03,0x88,0xFF,0x02,0xFC,0x00,0x03,0x89,0xFF,0x02,0xF0,0x00,0x3F,0x84,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,
+    0x3F,0x82,0xFF,0x02,0x00,0x00,0x03,0x88,0xFF,0x02,0xC0,0x00,0x03,0x88,0xFF,0x03,0xFC,0x00,0x00,0x0F,0x84,0xFF,0x01,0xFC,
+    0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x81,0xFF,0x03,0xFC,0x00,0x00,0x0F,0x87,0xFF,0x03,0xFC,0x00,0x00,0x0F,0x88,0xFF,0x03,0xC0,
+    0x00,0x00,0x3F,0x84,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x81,0xFF,0x02,0x00,0x00,0x0F,0x88,0xFF,0x02,0xC0,0x00,
+    0x0F,0x88,0xFF,0x02,0xFC,0x00,0x00,0x86,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x02,0xFC,0x00,0x03,0x88,
+    0xFF,0x02,0xFC,0x00,0x03,0x89,0xFF,0x02,0xC0,0x00,0x3F,0x86,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,
+    0xF0,0x00,0x89,0xFF,0x01,0xF0,0x00,0x8A,0xFF,0x01,0x00,0x03,0x87,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x80,0xFF,
+    0x03,0x00,0x0F,0xFF,0xFF,0x80,0x00,0x84,0xFF,0x03,0xC0,0x0F,0xFF,0xFF,0x80,0x00,0x84,0xFF,0x07,0xFC,0x00,0x3F,0xFF,0xFC,
+    0x00,0x00,0x03,0x82,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x08,0xF0,0x3F,0xFF,0xFF,0xFC,0x00,0x3F,0xFF,0xC0,0x80,0x00,0x00,0x03,
+    0x83,0xFF,0x03,0x00,0x3F,0xFF,0xC0,0x80,0x00,0x00,0x03,0x83,0xFF,0x03,0xF0,0x03,0xFF,0xFF,0x81,0x00,0x00,0x0F,0x81,0xFF,
+    0x01,0xFC,0x0F,0x89,0xFF,0x0D,0xF0,0x3F,0xFF,0xFF,0xF0,0x03,0xFF,0xFC,0x00,0x0F,0xFF,0xF0,0x00,0x3F,0x81,0xFF,0x03,0xFC,
+    0x00,0xFF,0xFC,0x82,0x00,0x00,0x3F,0x82,0xFF,0x08,0xC0,0x0F,0xFF,0xF0,0x00,0x3F,0xFF,0xC0,0x00,0x81,0xFF,0x01,0xFC,0x0F,
+    0x89,0xFF,0x08,0xF0,0x3F,0xFF,0xFF,0xF0,0x0F,0xFF,0xF0,0x0F,0x80,0xFF,0x01,0xF0,0x0F,0x81,0xFF,0x03,0xF0,0x03,0xFF,0xF0,
+    0x82,0x00,0x00,0x03,0x82,0xFF,0x04,0x00,0x3F,0xFF,0x00,0x3F,0x80,0xFF,0x01,0xC0,0x3F,0x80,0xFF,0x01,0xFC,0x0F,0x89,0xFF,
+    0x07,0xF0,0x3F,0xFF,0xFF,0xC0,0x3F,0xFF,0x00,0x82,0xFF,0x00,0x00,0x81,0xFF,0x03,0xC0,0x0F,0xFF,0xC0,0x83,0x00,0x82,0xFF,
+    0x03,0x00,0xFF,0xFC,0x03,0x81,0xFF,0x01,0xFC,0x0F,0x80,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x07,0xF0,0x3F,0xFF,0xFF,0x00,0xFF,
+    0xFC,0x03,0x82,0xFF,0x01,0xC0,0x3F,0x80,0xFF,0x02,0xC0,0x3F,0xFC,0x84,0x00,0x00,0x3F,0x80,0xFF,0x04,0xFC,0x03,0xFF,0xF0,
+    0x0F,0x82,0xFF,0x00,0x00,0x80,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x07,0xF0,0x3F,0xFF,0xFF,0x00,0xFF,0xF0,0x3F,0x82,0xFF,0x01,
+    0xFC,0x0F,0x80,0xFF,0x02,0x00,0xFF,0xF0,0x84,0x00,0x00,0x0F,0x80,0xFF,0x03,0xF0,0x0F,0xFF,0xC0,0x83,0xFF,0x05,0xF0,0x3F,
+    0xFF,0xFF,0xFC,0x0F,0x89,0xFF,0x06,0xF0,0x3F,0xFF,0xFC,0x03,0xFF,0xC0,0x84,0xFF,0x00,0x03,0x80,0xFF,0x02,0x00,0xFF,0xF0,
+    0x84,0x00,0x00,0x03,0x80,0xFF,0x03,0xF0,0x0F,0xFF,0x03,0x83,0xFF,0x05,0xFC,0x0F,0xFF,0xFF,0xFC,0x0F,0x89,0xFF,0x06,0xF0,
+    0x3F,0xFF,0xFC,0x03,0xFF,0x03,0x84,0xFF,0x06,0xC0,0xFF,0xFF,0xFC,0x03,0xFF,0xC0,0x85,0x00,0x80,0xFF,0x03,0xC0,0x3F,0xFC,
+    0x0F,0x84,0xFF,0x04,0x0F,0xFF,0xFF,0xFC,0x0F,0x89,0xFF,0x06,0xF0,0x3F,0xFF,0xF0,0x0F,0xFF,0x0F,0x84,0xFF,0x05,0xF0,0xFF,
+    0xFF,0xFC,0x0F,0xFF,0x86,0x00,0x06,0x3F,0xFF,0xFF,0xC0,0xFF,0xF0,0x3F,0x84,0xFF,0x04,0xC3,0xFF,0xFF,0xFC,0x0F,0x89,0xFF,
+    0x06,0xF0,0x3F,0xFF,0xF0,0x0F,0xFC,0x0F,0x84,0xFF,0x05,0xF0,0x3F,0xFF,0xF0,0x0F,0xFC,0x86,0x00,0x06,0x3F,0xFF,0xFF,0xC0,
+    0xFF,0xF0,0x3F,0x84,0xFF,0x04,0xC0,0xFF,0xFF,0xFC,0x0F,0x89,0xFF,0x06,0xF0,0x3F,0xFF,0xF0,0x3F,0xF0,0x3F,0x84,0xFF,0x05,
+    0xFC,0x0F,0xFF,0xF0,0x0F,0xFC,0x86,0x00,0x05,0x0F,0xFF,0xFF,0x00,0xFF,0xC0,0x85,0xFF,0x04,0xF0,0xFF,0xFF,0xFC,0x0F,0x89,
+    0xFF,0x05,0xF0,0x3F,0xFF,0xC0,0x3F,0xF0,0x86,0xFF,0x04,0x0F,0xFF,0xF0,0x3F,0xF0,0x86,0x00,0x05,0x0F,0xFF,0xFF,0x03,0xFF,
+    0xC3,0x85,0xFF,0x04,0xFC,0x3F,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0xC0,0x3F,0xC0,0x86,0xFF,0x04,0x03,0xFF,0xC0,
+    0x3F,0xF0,0x86,0x00,0x05,0x03,0xFF,0xFF,0x03,0xFF,0x03,0x85,0xFF,0x04,0xFC,0x3F,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,
+    0xFF,0xC0,0xFF,0xC3,0x86,0xFF,0x04,0xC3,0xFF,0xC0,0x3F,0xF0,0x86,0x00,0x05,0x03,0xFF,0xFC,0x03,0xFF,0x0F,0x86,0xFF,0x03,
+    0x0F,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0xC0,0xFF,0xC3,0x86,0xFF,0x04,0xC3,0xFF,0xC0,0x3F,0xC0,0x87,0x00,0x04,
+    0xFF,0xFC,0x03,0xFF,0x0F,0x86,0xFF,0x03,0x0F,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0xC0,0xFF,0xC3,0x86,0xFF,0x04,
+    0xC3,0xFF,0xC0,0xFF,0xC0,0x87,0x00,0x04,0xFF,0xFC,0x03,0xFC,0x0F,0x86,0xFF,0x03,0x0F,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,
+    0x3F,0xFF,0x00,0xFF,0x03,0x86,0xFF,0x04,0xC0,0xFF,0xC0,0xFF,0xC0,0x87,0x00,0x04,0xFF,0xFC,0x0F,0xFC,0x0F,0x86,0xFF,0x03,
+    0x0F,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0x00,0xFF,0x0F,0x86,0xFF,0x04,0xF0,0xFF,0xC0,0xFF,0xC0,0x87,0x00,0x04,
+    0xFF,0xFC,0x0F,0xFC,0x3F,0x86,0xFF,0x03,0xC3,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0x00,0xFF,0x0F,0x86,0xFF,0x04,
+    0xF0,0xFF,0xC0,0xFF,0xC0,0x87,0x00,0x04,0xFF,0xFC,0x0F,0xFC,0x3F,0x86,0xFF,0x03,0xC3,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,
+    0x3F,0xFF,0x00,0xFF,0x0F,0x86,0xFF,0x06,0xF0,0xFF,0xC0,0xFF,0x00,0x00,0xF0,0x85,0x00,0x04,0xFF,0xFC,0x0F,0xFC,0x3F,0x86,
+    0xFF,0x03,0xC3,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0x00,0xFF,0x0F,0x86,0xFF,0x06,0xF0,0xFF,0xC0,0xFF,0x00,0x00,
+    0xF0,0x85,0x00,0x04,0xFF,0xFC,0x0F,0xFC,0x3F,0x86,0xFF,0x03,0xC3,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0x00,0xFF,
+    0x0F,0x86,0xFF,0x06,0xF0,0xFF,0xC0,0xFF,0x00,0x00,0xF0,0x85,0x00,0x04,0xFF,0xFC,0x0F,0xFC,0x3F,0x86,0xFF,0x03,0xC3,0xFF,
+    0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0x00,0xFF,0x0F,0x86,0xFF,0x06,0xF0,0xFF,0xC0,0xFF,0x00,0x00,0xF0,0x85,0x00,0x04,
+    0xFF,0xFC,0x0F,0xFC,0x3F,0x86,0xFF,0x03,0xC3,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0x00,0xFF,0x0F,0x86,0xFF,0x06,
+    0xF0,0xFF,0xC0,0xFF,0xC0,0x00,0xF0,0x85,0x00,0x04,0xFF,0xFC,0x0F,0xFC,0x3F,0x86,0xFF,0x03,0xC3,0xFF,0xFC,0x0F,0x89,0xFF,
+    0x05,0xF0,0x3F,0xFF,0x00,0xFF,0x0F,0x86,0xFF,0x06,0xF0,0xFF,0xC0,0xFF,0xC0,0x00,0x3C,0x85,0x00,0x04,0xFF,0xFC,0x0F,0xFC,
+    0x3F,0x86,0xFF,0x03,0xCF,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0x00,0xFF,0x03,0x86,0xFF,0x06,0xC0,0xFF,0xC0,0xFF,
+    0xC0,0x00,0x3C,0x85,0x00,0x04,0xFF,0xFC,0x0F,0xFC,0x0F,0x86,0xFF,0x03,0x0F,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,
+    0xC0,0xFF,0xC3,0x86,0xFF,0x06,0xC3,0xFF,0xC0,0xFF,0xC0,0x00,0x0F,0x85,0x00,0x04,0xFF,0xFC,0x03,0xFC,0x0F,0x86,0xFF,0x03,
+    0x0F,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0xC0,0xFF,0xC3,0x86,0xFF,0x07,0xC3,0xFF,0xC0,0x3F,0xC0,0x00,0x0F,0xC0,
+    0x83,0x00,0x05,0x03,0xFF,0xFC,0x03,0xFF,0x0F,0x86,0xFF,0x03,0x0F,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0xC0,0xFF,
+    0xC3,0x86,0xFF,0x07,0xC3,0xFF,0xC0,0x3F,0xF0,0x00,0x03,0xF0,0x83,0x00,0x05,0x03,0xFF,0xFC,0x03,0xFF,0x0F,0x86,0xFF,0x03,
+    0x0F,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0xC0,0x3F,0xF0,0x86,0xFF,0x07,0x0F,0xFF,0xF0,0x3F,0xF0,0x00,0x00,0xFC,
+    0x83,0x00,0x05,0x03,0xFF,0xFF,0x03,0xFF,0x03,0x85,0xFF,0x04,0xFC,0x3F,0xFF,0xFC,0x0F,0x89,0xFF,0x05,0xF0,0x3F,0xFF,0xC0,
+    0x3F,0xF0,0x86,0xFF,0x07,0x0F,0xFF,0xF0,0x3F,0xFC,0x00,0x00,0x3F,0x83,0x00,0x05,0x0F,0xFF,0xFF,0x03,0xFF,0xC3,0x85,0xFF,
+    0x04,0xFC,0x3F,0xFF,0xFC,0x0F,0x89,0xFF,0x06,0xF0,0x3F,0xFF,0xF0,0x3F,0xFC,0x3F,0x84,0xFF,0x09,0xFC,0x3F,0xFF,0xF0,0x0F,
+    0xFC,0x00,0x00,0x0F,0xF0,0x82,0x00,0x05,0x0F,0xFF,0xFF,0x00,0xFF,0xC0,0x85,0xFF,0x04,0xF0,0xFF,0xFF,0xFC,0x0F,0x89,0xFF,
+    0x06,0xF0,0x3F,0xFF,0xF0,0x0F,0xFC,0x0F,0x84,0xFF,0x05,0xF0,0x3F,0xFF,0xF0,0x0F,0xFF,0x80,0x00,0x01,0xFF,0xF0,0x81,0x00,
+    0x06,0x3F,0xFF,0xFF,0xC0,0xFF,0xF0,0x3F,0x84,0xFF,0x04,0xC0,0xFF,0xFF,0xFC,0x0F,0x89,0xFF,0x06,0xF0,0x3F,0xFF,0xF0,0x0F,
+    0xFF,0x0F,0x84,0xFF,0x05,0xF0,0xFF,0xFF,0xFC,0x0F,0xFF,0x80,0x00,0x01,0x0F,0xF0,0x81,0x00,0x80,0xFF,0x03,0xC0,0x3F,0xF0,
+    0x3F,0x84,0xFF,0x04,0xC3,0xFF,0xFF,0xFC,0x0F,0x89,0xFF,0x06,0xF0,0x3F,0xFF,0xFC,0x03,0xFF,0xC3,0x84,0xFF,0x06,0xC3,0xFF,
+    0xFF,0xFC,0x03,0xFF,0xC0,0x85,0x00,0x80,0xFF,0x03,0xC0,0x3F,0xFC,0x0F,0x84,0xFF,0x04,0x0F,0xFF,0xFF,0xFC,0x0F,0x89,0xFF,
+    0x06,0xF0,0x3F,0xFF,0xFC,0x03,0xFF,0xC0,0x84,0xFF,0x06,0x03,0xFF,0xFF,0xFC,0x00,0xFF,0xF0,0x84,0x00,0x00,0x03,0x80,0xFF,
+    0x03,0xF0,0x0F,0xFF,0x03,0x83,0xFF,0x05,0xFC,0x3F,0xFF,0xFF,0xFC,0x0F,0x89,0xFF,0x07,0xF0,0x3F,0xFF,0xFF,0x00,0xFF,0xF0,
+    0x3F,0x82,0xFF,0x01,0xFC,0x0F,0x80,0xFF,0x02,0x00,0xFF,0xFC,0x84,0x00,0x00,0x0F,0x80,0xFF,0x03,0xF0,0x0F,0xFF,0xC0,0x83,
+    0xFF,0x00,0xF0,0x80,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x07,0xF0,0x3F,0xFF,0xFF,0x00,0xFF,0xFC,0x03,0x82,0xFF,0x01,0xC0,0x3F,
+    0x80,0xFF,0x02,0xC0,0x3F,0xFF,0x84,0x00,0x00,0x3F,0x80,0xFF,0x04,0xFC,0x03,0xFF,0xF0,0x0F,0x82,0xFF,0x00,0x03,0x80,0xFF,
+    0x01,0xFC,0x0F,0x89,0xFF,0x07,0xF0,0x3F,0xFF,0xFF,0xC0,0x3F,0xFF,0xC0,0x82,0xFF,0x00,0x03,0x81,0xFF,0x03,0xC0,0x0F,0xFF,
+    0xC0,0x83,0x00,0x82,0xFF,0x03,0x00,0xFF,0xFC,0x03,0x81,0xFF,0x01,0xFC,0x0F,0x80,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x08,0xF0,
+    0x3F,0xFF,0xFF,0xF0,0x0F,0xFF,0xF0,0x0F,0x80,0xFF,0x01,0xF0,0x0F,0x81,0xFF,0x03,0xF0,0x03,0xFF,0xF0,0x82,0x00,0x00,0x0F,
+    0x82,0xFF,0x04,0x00,0x3F,0xFF,0xC0,0x3F,0x80,0xFF,0x01,0xC0,0x3F,0x80,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x0C,0xF0,0x3F,0xFF,
+    0xFF,0xF0,0x03,0xFF,0xFF,0x00,0x0F,0xFF,0xF0,0x00,0x82,0xFF,0x03,0xFC,0x00,0xFF,0xFF,0x82,0x00,0x00,0x3F,0x82,0xFF,0x08,
+    0xC0,0x0F,0xFF,0xF0,0x00,0x3F,0xFF,0xC0,0x03,0x81,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x08,0xF0,0x3F,0xFF,0xFF,0xFC,0x00,0x3F,
+    0xFF,0xF0,0x80,0x00,0x00,0x0F,0x83,0xFF,0x03,0x00,0x3F,0xFF,0xF0,0x80,0x00,0x00,0x03,0x83,0xFF,0x03,0xF0,0x03,0xFF,0xFF,
+    0x81,0x00,0x00,0x3F,0x81,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x06,0xC0,0x0F,0xFF,0xFF,0xC0,0x00,0x03,
+    0x84,0xFF,0x06,0xC0,0x0F,0xFF,0xFF,0xC0,0x00,0x03,0x84,0xFF,0x07,0xFC,0x00,0x3F,0xFF,0xFF,0x00,0x00,0x0F,0x82,0xFF,0x01,
+    0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x00,0x89,0xFF,0x02,0xF0,0x00,0x3F,0x89,0xFF,0x01,0x00,0x03,0x87,
+    0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x02,0xFC,0x00,0x03,0x88,0xFF,0x02,0xFC,0x00,0x03,0x89,0xFF,0x02,
+    0xC0,0x00,0x3F,0x86,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x81,0xFF,0x02,0xC0,0x00,0x0F,0x88,0xFF,0x02,0xC0,0x00,
+    0x0F,0x88,0xFF,0x03,0xFC,0x00,0x00,0x3F,0x85,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0x81,0xFF,0x03,0xF0,0x00,0x00,
+    0x0F,0x87,0xFF,0x03,0xFC,0x00,0x00,0x0F,0x88,0xFF,0x02,0xC0,0x00,0x00,0x85,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,
+    0x82,0xFF,0x02,0x00,0x00,0x0F,0x88,0xFF,0x02,0xC0,0x00,0x0F,0x88,0xFF,0x02,0xFC,0x00,0x00,0x85,0xFF,0x01,0xFC,0x0F,0x89,
+    0xFF,0x01,0xF0,0x3F,0x82,0xFF,0x02,0xFC,0x00,0x0F,0x89,0xFF,0x01,0x00,0x0F,0x89,0xFF,0x01,0xF0,0x00,0x85,0xFF,0x01,0xFC,
+    0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,
+    0xF0,0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,
+    0x01,0xFC,0x0F,0x89,0xFF,0x01,0xF0,0x3F,0xA9,0xFF,0x01,0xF0,0x0F,0x89,0xFF,0x01,0xF0,0x0F,0xA9,0xFF,0x01,0xF0,0x3F,0x89,
+    0xFF,0x01,0xFC,0x03,0xA9,0xFF,0x01,0xC0,0x3F,0x89,0xFF,0x01,0xFC,0x00,0xA8,0xFF,0x01,0xFC,0x00,0x8B,0xFF,0xAB,0x00,0x8B,
+    0xFF,0x00,0xC0,0xA9,0x00,0x00,0x0F,0x8B,0xFF,0x00,0xFC,0xA9,0x00,0x00,0x3F,0x8D,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,
+    0x03,0x85,0xFF,0x00,0x00,0x81,0xFF,0x01,0xC0,0x3F,0x84,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x03,0x95,0xFF,0x01,0xF0,
+    0x3F,0x80,0xFF,0x01,0xFC,0x0F,0x85,0xFF,0x00,0x00,0x81,0xFF,0x00,0xC0,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x03,
+    0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x0F,0x85,0xFF,0x00,0x00,0x81,0xFF,0x00,0xC0,0x85,0xFF,0x01,0xF0,0x3F,0x80,
+    0xFF,0x01,0xFC,0x03,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x0F,0x85,0xFF,0x00,0x00,0x81,0xFF,0x00,0xC0,0x85,0xFF,
+    0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x0F,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x0F,0x85,0xFF,0x00,0x00,0x81,0xFF,
+    0x00,0xC0,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xFC,0x0F,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x0F,0x85,0xFF,
+    0x00,0x00,0x81,0xFF,0x00,0x00,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x0F,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,
+    0xF0,0x3F,0x85,0xFF,0x00,0x00,0x81,0xFF,0x00,0x03,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,0x0F,0x95,0xFF,0x01,0xF0,
+    0x3F,0x80,0xFF,0x01,0xC0,0x3F,0x85,0xFF,0x00,0x00,0x80,0xFF,0x01,0xFC,0x03,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x01,0xF0,
+    0x3F,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x00,0xC0,0x86,0xFF,0x00,0x00,0x80,0xFF,0x01,0xFC,0x03,0x85,0xFF,0x01,0xF0,0x3F,
+    0x80,0xFF,0x01,0xC0,0x3F,0x95,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x00,0x00,0x86,0xFF,0x00,0x00,0x80,0xFF,0x01,0xF0,0x0F,0x85,
+    0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x00,0xC0,0x96,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x00,0x00,0x86,0xFF,0x00,0x00,0x80,0xFF,0x01,
+    0xF0,0x3F,0x85,0xFF,0x01,0xF0,0x3F,0x80,0xFF,0x00,0x00,0x96,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xFC,0x03,0x86,0xFF,0x00,0x00,
+    0x80,0xFF,0x01,0xC0,0x3F,0x85,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xFC,0x03,0x96,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xF0,0x0F,0x86,
+    0xFF,0x00,0x00,0x80,0xFF,0x00,0x00,0x86,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xF0,0x03,0x96,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xC0,
+    0x3F,0x86,0xFF,0x04,0x00,0xFF,0xFF,0xFC,0x00,0x86,0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0xC0,0x0F,0x96,0xFF,0x05,0xF0,0x3F,0xFF,
+    0xFC,0x00,0x3F,0x86,0xFF,0x04,0x00,0xFF,0xFF,0xC0,0x03,0x86,0xFF,0x05,0xF0,0x3F,0xFF,0xFC,0x00,0x3F,0x96,0xFF,0x04,0xF0,
+    0x3F,0xFF,0xC0,0x03,0x87,0xFF,0x04,0x00,0xFF,0xFC,0x00,0x3F,0x86,0xFF,0x04,0xF0,0x3F,0xFF,0xC0,0x00,0x97,0xFF,0x04,0xF0,
+    0x3F,0xF0,0x00,0x0F,0x87,0xFF,0x03,0x00,0xFF,0x00,0x00,0x87,0xFF,0x04,0xF0,0x3F,0xF0,0x00,0x0F,0x97,0xFF,0x00,0xF0,0x80,
+    0x00,0x88,0xFF,0x80,0x00,0x00,0x03,0x87,0xFF,0x00,0xF0,0x80,0x00,0x00,0x3F,0x97,0xFF,0x03,0xF0,0x00,0x00,0x03,0x88,0xFF,
+    0x80,0x00,0x00,0x3F,0x87,0xFF,0x03,0xF0,0x00,0x00,0x03,0x98,0xFF,0x02,0xFC,0x00,0x00,0x89,0xFF,0x02,0xC0,0x00,0x0F,0x88,
+    0xFF,0x02,0xFC,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x90,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD6,0xFF,0x02,0xF0,0x00,
+    0x0F,0xB5,0xFF,0x00,0xF0,0x80,0x00,0x00,0x0F,0xB4,0xFF,0x82,0x00,0xB3,0xFF,0x00,0xFC,0x82,0x00,0x00,0x3F,0xB2,0xFF,0x00,
+    0xC0,0x82,0x00,0x00,0x03,0xB2,0xFF,0x84,0x00,0xB1,0xFF,0x00,0xFC,0x84,0x00,0x00,0x3F,0xB0,0xFF,0x00,0xF0,0x84,0x00,0x00,
+    0x0F,0xB0,0xFF,0x00,0xF0,0x84,0x00,0x00,0x0F,0xB0,0xFF,0x00,0xC0,0x84,0x00,0x00,0x03,0xB0,0xFF,0x86,0x00,0xB0,0xFF,0x86,
+    0x00,0xAF,0xFF,0x00,0xFC,0x86,0x00,0x00,0x3F,0xAE,0xFF,0x00,0xFC,0x86,0x00,0x00,0x3F,0xAE,0xFF,0x00,0xFC,0x86,0x00,0x00,
+    0x3F,0xAE,0xFF,0x00,0xFC,0x86,0x00,0x00,0x3F,0xAE,0xFF,0x00,0xF0,0x86,0x00,0x00,0x0F,0xAE,0xFF,0x00,0xF0,0x86,0x00,0x00,
+    0x0F,0xAE,0xFF,0x02,0xF0,0x00,0xF0,0x84,0x00,0x00,0x0F,0xAE,0xFF,0x02,0xF0,0x00,0xF0,0x84,0x00,0x00,0x0F,0xAE,0xFF,0x02,
+    0xF0,0x00,0xF0,0x84,0x00,0x00,0x0F,0xAE,0xFF,0x02,0xF0,0x00,0xF0,0x84,0x00,0x00,0x0F,0xAE,0xFF,0x02,0xF0,0x00,0xF0,0x84,
+    0x00,0x00,0x0F,0xAE,0xFF,0x02,0xF0,0x00,0x3C,0x84,0x00,0x00,0x0F,0xAE,0xFF,0x02,0xFC,0x00,0x3C,0x84,0x00,0x00,0x3F,0xAE,
+    0xFF,0x02,0xFC,0x00,0x0F,0x84,0x00,0x00,0x3F,0xAE,0xFF,0x03,0xFC,0x00,0x0F,0xC0,0x83,0x00,0x00,0x3F,0xAE,0xFF,0x03,0xFC,
+    0x00,0x03,0xF0,0x83,0x00,0x00,0x3F,0xAF,0xFF,0x02,0x00,0x00,0xFC,0x83,0x00,0xB0,0xFF,0x02,0x00,0x00,0x3F,0x83,0x00,0xB0,
+    0xFF,0x03,0xC0,0x00,0x0F,0xF0,0x81,0x00,0x00,0x03,0xB0,0xFF,0x04,0xF0,0x00,0x00,0xFF,0xF0,0x80,0x00,0x00,0x0F,0xB0,0xFF,
+    0x04,0xF0,0x00,0x00,0x0F,0xF0,0x80,0x00,0x00,0x0F,0xB0,0xFF,0x00,0xFC,0x84,0x00,0x00,0x3F,0xB1,0xFF,0x84,0x00,0xB2,0xFF,
+    0x00,0xC0,0x82,0x00,0x00,0x03,0xB2,0xFF,0x00,0xFC,0x82,0x00,0x00,0x3F,0xB3,0xFF,0x82,0x00,0xB4,0xFF,0x00,0xF0,0x80,0x00,
+    0x00,0x0F,0xB5,0xFF,0x02,0xF0,0x00,0x0F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD5,0xFF
+};
+
+#endif
@@ -0,0 +1,41 @@
+#include <Arduino.h>
+#include <Adafruit_GFX.h>           // Core library for graphics (GFX)  & text 
+#include "PL_smallLegio.h"          // Display-specific library for 4pigment media (Legio, 6colors)
+
+#include "IMG_trafficLight_ryg.h"   // Imported image (as bytestream) from PL Image Inverter tool 
+
+#define EPD_RST     12
+#define EPD_BUSY    9
+#define EPD_CS      5
+                                    // Declare 4pigment based EPD instance with 6 colors
+PL_smallLegio epd(EPD_CS, EPD_RST, EPD_BUSY);   
+
+// Update profiles per temperature band, sorted by minTemp. The room temperature band
+// keeps the original constants, the others are a starting point to be tuned per panel.
+// The source voltage is set in whole volts, so voltageDelta steps by 1000mV.
+static const EPD_updateProfile profiles[] = {
+//    minTemp  passDelta  voltageDelta[mV]  dwell[ms]  allowMono
+    { -128,    +1,        +2000,            10,        false },     // below 5°C
+    {    5,     0,        +1000,             5,        true  },     // 5..14°C
+    {   15,     0,            0,             1,        true  },     // 15..29°C, room temp.
+    {   30,    -1,        -1000,             1,        true  }      // 30°C and above
+};
+
+void setup() {  
+    Serial.begin(115200);
+    SPI.begin();                    // SPI initialisation, UC8156 supp. max 10Mhz (writing) & 
+    SPI.beginTransaction(SPISettings(6000000, MSBFIRST, SPI_MODE0));      // 6.6Mhz (reading)
+
+    epd.setUpdateProfiles(profiles, sizeof(profiles) / sizeof(profiles[0]));
+    epd.setTemperatureInterval(300000);     // Read the sensor every 5 minutes at most
+    epd.begin(EPD_BLACK);           // EPD initialisation & ClearScreen
+}
+
+void loop() {       
+    epd.showImage(IMG_trafficLight_ryg);    // Passes & voltages follow the temperature
+    Serial.print("Temperature: ");
+    Serial.print(epd.getTemperature());
+    Serial.print("C, profile ");
+    Serial.println(epd.getProfileIndex());
+    delay(600000);
+}
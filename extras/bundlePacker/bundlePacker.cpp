@@ -0,0 +1,217 @@
+/* *****************************************************************************************
+bundlePacker - Host tool building an image bundle (format see src/PL_smallBundle.h) from
+a directory of images as exported by the PL Image Inverter tool, either as C header
+(IMG_xyz.h, the hex bytes are parsed) or as raw binary (.bin). Identical planes are
+stored only once, color planes without pigment are dropped (the BW plane is kept, its
+pass drives the white background) and every plane is run length coded if that makes it
+smaller. The result is a header with one PROGMEM array plus a #define
+per image ID, to be used with PL_smallLegio::showImage(bundle, id). Build & run:
+
+    g++ -O2 -std=c++11 -I../../src bundlePacker.cpp ../../src/PL_smallRLE.cpp -o bundlePacker
+    ./bundlePacker [-raw] <image directory> <output.h> <array name>
+
+Released under BSD license (3-clause BSD license), check license.md for more information.
+***************************************************************************************** */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <dirent.h>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include "PL_smallRLE.h"
+#include "PL_smallBundle.h"
+
+#define IMG_HEADER  10              // bytes in front of the first plane
+#define PLANE_SIZE  8760            // 240 x 146 pixels, 2 bit each
+
+struct Image {
+    std::string name;
+    uint8_t flags;
+    uint16_t record[EPD_BUNDLE_PLANES];
+};
+
+struct Record {
+    std::vector<uint8_t> data;      // as stored in the bundle
+    uint8_t encoding;
+    uint32_t offset;
+};
+
+static bool readImage(const std::string &path, std::vector<uint8_t> &img) {
+    FILE *f = fopen(path.c_str(), "rb");
+    if (!f) return false;
+    std::vector<char> text;
+    char buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) text.insert(text.end(), buf, buf + n);
+    fclose(f);
+
+    img.clear();
+    if (path.size() > 2 && path.compare(path.size() - 2, 2, ".h") == 0) {
+        text.push_back(0);
+        const char *p = strchr(&text[0], '{');      // skip the #define / #ifndef lines
+        for (; p && *p; p++)
+            if (p[0] == '0' && (p[1] == 'x' || p[1] == 'X') && isxdigit((uint8_t)p[2])) {
+                img.push_back((uint8_t)strtoul(p, (char **)&p, 16));
+                p--;
+            }
+    } else
+        img.assign(text.begin(), text.end());
+    return img.size() >= IMG_HEADER + PLANE_SIZE;
+}
+
+static uint32_t fnv1a(const uint8_t *p, size_t n) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < n; i++) h = (h ^ p[i]) * 16777619u;
+    return h;
+}
+
+static void rleWrite(uint8_t b, void *ctx) {
+    ((std::vector<uint8_t> *)ctx)->push_back(b);
+}
+
+static void put16(std::vector<uint8_t> &v, uint32_t x) {
+    v.push_back(x & 0xFF);
+    v.push_back((x >> 8) & 0xFF);
+}
+
+int main(int argc, char **argv) {
+    bool compress = true;
+    int a = 1;
+    if (a < argc && strcmp(argv[a], "-raw") == 0) {
+        compress = false;
+        a++;
+    }
+    if (argc - a != 3) {
+        fprintf(stderr, "usage: %s [-raw] <image directory> <output.h> <array name>\n", argv[0]);
+        return 1;
+    }
+    std::string dir = argv[a], out = argv[a + 1], array = argv[a + 2];
+
+    std::vector<std::string> files;
+    DIR *d = opendir(dir.c_str());
+    if (!d) {
+        perror(dir.c_str());
+        return 1;
+    }
+    while (struct dirent *e = readdir(d)) {
+        std::string f = e->d_name;
+        if ((f.size() > 2 && f.compare(f.size() - 2, 2, ".h") == 0) ||
+            (f.size() > 4 && f.compare(f.size() - 4, 4, ".bin") == 0))
+            files.push_back(f);
+    }
+    closedir(d);
+    std::sort(files.begin(), files.end());
+
+    std::vector<Image> images;
+    std::vector<Record> records;
+    std::vector<std::vector<uint8_t> > planes;      // raw content of each record
+    std::multimap<uint32_t, uint16_t> byHash;
+    long rawBytes = 0, planeCount = 0;
+
+    for (auto &f : files) {
+        std::vector<uint8_t> img;
+        if (!readImage(dir + "/" + f, img)) {
+            fprintf(stderr, "skipping %s: not an image\n", f.c_str());
+            continue;
+        }
+        Image im;
+        im.name = f.substr(0, f.rfind('.'));
+        if (im.name.compare(0, 4, "IMG_") == 0) im.name = im.name.substr(4);
+        if (im.name.size() > EPD_BUNDLE_NAMELEN) {
+            fprintf(stderr, "%s: name truncated to %d characters\n", f.c_str(), EPD_BUNDLE_NAMELEN);
+            im.name.resize(EPD_BUNDLE_NAMELEN);
+        }
+        im.flags = 0;
+        rawBytes += img.size();
+
+        for (int p = 0; p < EPD_BUNDLE_PLANES; p++) {
+            im.record[p] = EPD_BUNDLE_NOPLANE;
+            size_t start = IMG_HEADER + p * PLANE_SIZE;
+            if (!(img[3] & (0x80 >> p)) || img.size() < start + PLANE_SIZE) continue;
+            const uint8_t *plane = &img[start];
+            if ((p > 0) && std::all_of(plane, plane + PLANE_SIZE, [](uint8_t b) { return b == 0xFF; }))
+                continue;                           // no pigment; BW is kept, it drives white
+
+            planeCount++;
+            im.flags |= 0x80 >> p;
+            uint32_t h = fnv1a(plane, PLANE_SIZE);
+            auto range = byHash.equal_range(h);
+            for (auto it = range.first; it != range.second; ++it)
+                if (memcmp(&planes[it->second][0], plane, PLANE_SIZE) == 0)
+                    im.record[p] = it->second;
+            if (im.record[p] != EPD_BUNDLE_NOPLANE) continue;
+
+            Record r;
+            r.offset = 0;
+            r.encoding = EPD_BUNDLE_RAW;
+            r.data.assign(plane, plane + PLANE_SIZE);
+            if (compress) {
+                std::vector<uint8_t> rle;
+                PL_smallRLE::encode(plane, PLANE_SIZE, rleWrite, &rle);
+                if (rle.size() < r.data.size()) {
+                    r.data.swap(rle);
+                    r.encoding = EPD_BUNDLE_RLE;
+                }
+            }
+            im.record[p] = records.size();
+            byHash.insert(std::make_pair(h, (uint16_t)records.size()));
+            records.push_back(r);
+            planes.push_back(std::vector<uint8_t>(plane, plane + PLANE_SIZE));
+        }
+        images.push_back(im);
+    }
+    if (images.empty()) {
+        fprintf(stderr, "no images found in %s\n", dir.c_str());
+        return 1;
+    }
+
+    std::vector<uint8_t> blob(EPD_BUNDLE_MAGIC, EPD_BUNDLE_MAGIC + 4);
+    put16(blob, images.size());
+    put16(blob, records.size());
+    for (auto &im : images) {
+        for (int i = 0; i < EPD_BUNDLE_NAMELEN; i++)
+            blob.push_back(i < (int)im.name.size() ? im.name[i] : 0);
+        blob.push_back(im.flags);
+        blob.push_back(0);
+        for (int p = 0; p < EPD_BUNDLE_PLANES; p++) put16(blob, im.record[p]);
+    }
+    uint32_t offset = blob.size() + records.size() * EPD_BUNDLE_RECORD;
+    for (auto &r : records) {
+        r.offset = offset;
+        put16(blob, offset & 0xFFFF);
+        put16(blob, offset >> 16);
+        put16(blob, r.data.size());
+        blob.push_back(r.encoding);
+        blob.push_back(0);
+        offset += r.data.size();
+    }
+    for (auto &r : records) blob.insert(blob.end(), r.data.begin(), r.data.end());
+
+    FILE *f = fopen(out.c_str(), "w");
+    if (!f) {
+        perror(out.c_str());
+        return 1;
+    }
+    std::string guard = array;
+    for (auto &c : guard) c = toupper((uint8_t)c);
+    fprintf(f, "#ifndef %s_h\n#define %s_h\n\n", guard.c_str(), guard.c_str());
+    fprintf(f, "// Image bundle built by bundlePacker: %zu images, %zu planes stored, %zu bytes\n\n",
+        images.size(), records.size(), blob.size());
+    for (size_t i = 0; i < images.size(); i++) {
+        std::string id = images[i].name;
+        for (auto &c : id) c = isalnum((uint8_t)c) ? toupper((uint8_t)c) : '_';
+        fprintf(f, "#define %s_%s %zu\n", guard.c_str(), id.c_str(), i);
+    }
+    fprintf(f, "\nconst unsigned char %s[] PROGMEM = {", array.c_str());
+    for (size_t i = 0; i < blob.size(); i++)
+        fprintf(f, "%s0x%02X", i % 24 ? "," : (i ? ",\n    " : "\n    "), blob[i]);
+    fprintf(f, "\n};\n\n#endif\n");
+    fclose(f);
+
+    printf("%zu images, %ld planes -> %zu stored, %ld bytes -> %zu bytes (%.1f%%)\n", images.size(),
+        planeCount, records.size(), rawBytes, blob.size(), 100.0 * blob.size() / rawBytes);
+    return 0;
+}
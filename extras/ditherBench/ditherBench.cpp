@@ -0,0 +1,65 @@
+/* *****************************************************************************************
+ditherBench - Host benchmark for the PL_smallDither engine. Dithers a full 240x146 frame
+(grey gradient and RGB gradient) repeatedly and prints the time per frame, plus a PGM
+preview of the greyscale result. Build & run from this folder:
+
+    g++ -O2 -I../../src ditherBench.cpp ../../src/PL_smallDither.cpp -o ditherBench
+    ./ditherBench [iterations]
+
+Released under BSD license (3-clause BSD license), check license.md for more information.
+***************************************************************************************** */
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include "PL_smallDither.h"
+
+#define W 240
+#define H 146
+
+static uint8_t frame[W / 4 * H];
+static uint8_t gray[H][W];
+static uint8_t rgb[H][W * 3];
+static uint8_t idx[W];
+
+static double bench(const char *name, uint8_t mode, bool color, int n) {
+    PL_smallDither d;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; i++) {
+        d.begin(mode, W);
+        for (int y = 0; y < H; y++) {
+            if (color)
+                d.rgbRow(rgb[y], idx);
+            else
+                d.grayRow(gray[y], &frame[y * W / 4]);
+        }
+    }
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count() / n;
+    printf("%-22s %8.3f ms/frame\n", name, ms);
+    return ms;
+}
+
+int main(int argc, char **argv) {
+    int n = argc > 1 ? atoi(argv[1]) : 200;
+
+    for (int y = 0; y < H; y++)
+        for (int x = 0; x < W; x++) {
+            gray[y][x] = (uint8_t)(x * 255 / (W - 1));
+            rgb[y][x * 3 + 0] = (uint8_t)(x * 255 / (W - 1));
+            rgb[y][x * 3 + 1] = (uint8_t)(y * 255 / (H - 1));
+            rgb[y][x * 3 + 2] = (uint8_t)(255 - x * 255 / (W - 1));
+        }
+
+    bench("grey ordered", EPD_DITHER_ORDERED, false, n);
+    bench("grey floyd-steinberg", EPD_DITHER_FS, false, n);
+    bench("rgb ordered", EPD_DITHER_ORDERED, true, n);
+    bench("rgb floyd-steinberg", EPD_DITHER_FS, true, n);
+
+    FILE *f = fopen("ditherBench.pgm", "wb");
+    if (f) {
+        fprintf(f, "P5 %d %d 3\n", W, H);
+        for (int i = 0; i < W * H; i++)
+            fputc((frame[i / 4] >> (6 - 2 * (i % 4))) & 3, f);
+        fclose(f);
+    }
+    return 0;
+}
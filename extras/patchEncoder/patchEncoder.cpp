@@ -0,0 +1,199 @@
+/* *****************************************************************************************
+patchEncoder - Host tool writing a delta patch stream (format see src/PL_smallPatch.h)
+that turns the frame OLD into the frame NEW, to be sent e.g. over a serial or BLE link
+and applied with PL_smallEPD::applyPatches(). Frames are raw buffers of 240 x 146 pixels,
+2 bit each (8760 bytes), or images as exported by the PL Image Inverter tool in binary
+form, of which the first plane is used. Changed rows closer than GAP rows are merged into
+one rectangle, if the patch gets larger than a single full frame rectangle, that one is
+written instead. The result is decoded again and compared with NEW. Build & run:
+
+    g++ -O2 -std=c++11 -I../../src patchEncoder.cpp ../../src/PL_smallRLE.cpp -o patchEncoder
+    ./patchEncoder [-m mode] [-p plane] [-g gap] <old.bin> <new.bin> <patch.bin>
+
+MODE is the update mode hint (0 full, 1 partial, 2 mono, -1 none), PLANE the Legio color
+the frames belong to (default none).
+
+Released under BSD license (3-clause BSD license), check license.md for more information.
+***************************************************************************************** */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "PL_smallRLE.h"
+#include "PL_smallPatch.h"
+
+#define IMG_HEADER  10              // bytes in front of the first plane
+#define WIDTH       240
+#define HEIGHT      146
+#define STRIDE      (WIDTH / 4)
+#define PLANE_SIZE  (STRIDE * HEIGHT)
+
+struct Rect {
+    int x, y, w, h;                 // in bytes horizontally, rows vertically
+};
+
+static bool loadFrame(const char *path, uint8_t *frame) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return false;
+    std::vector<uint8_t> data;
+    uint8_t chunk[4096];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) data.insert(data.end(), chunk, chunk + n);
+    fclose(f);
+
+    if (data.size() == PLANE_SIZE) memcpy(frame, &data[0], PLANE_SIZE);
+    else if (data.size() >= IMG_HEADER + PLANE_SIZE) memcpy(frame, &data[IMG_HEADER], PLANE_SIZE);
+    else return false;
+    return true;
+}
+
+static void put16(std::vector<uint8_t> &out, int v) {
+    out.push_back(v & 0xFF);
+    out.push_back((v >> 8) & 0xFF);
+}
+
+static void pushByte(uint8_t b, void *ctx) {
+    ((std::vector<uint8_t> *)ctx)->push_back(b);
+}
+
+static void encodeRect(std::vector<uint8_t> &out, const uint8_t *frame, const Rect &r, int plane) {
+    std::vector<uint8_t> rows;
+    for (int y = r.y; y < r.y + r.h; y++)
+        rows.insert(rows.end(), frame + y * STRIDE + r.x, frame + y * STRIDE + r.x + r.w);
+
+    out.push_back(EPD_PATCH_RECT);
+    put16(out, r.x * 4);
+    put16(out, r.y);
+    put16(out, r.w * 4);
+    put16(out, r.h);
+    out.push_back(plane);
+    PL_smallRLE::encode(&rows[0], rows.size(), pushByte, &out);
+}
+
+// Changed rows in bands, horizontally the union of the changed bytes of all rows
+static std::vector<Rect> diffFrames(const uint8_t *a, const uint8_t *b, int gap) {
+    std::vector<Rect> rects;
+    Rect cur = {0, 0, 0, 0};
+    int x1 = 0, lastRow = -1;
+
+    for (int y = 0; y < HEIGHT; y++) {
+        const uint8_t *p = a + y * STRIDE, *q = b + y * STRIDE;
+        int first = 0, last = STRIDE - 1;
+        while ((first < STRIDE) && (p[first] == q[first])) first++;
+        if (first == STRIDE) continue;
+        while (p[last] == q[last]) last--;
+
+        if ((lastRow >= 0) && (y - lastRow <= gap + 1)) {
+            if (first < cur.x) cur.x = first;
+            if (last > x1) x1 = last;
+        } else {
+            if (lastRow >= 0) {
+                cur.w = x1 - cur.x + 1;
+                cur.h = lastRow - cur.y + 1;
+                rects.push_back(cur);
+            }
+            cur.x = first;
+            cur.y = y;
+            x1 = last;
+        }
+        lastRow = y;
+    }
+    if (lastRow >= 0) {
+        cur.w = x1 - cur.x + 1;
+        cur.h = lastRow - cur.y + 1;
+        rects.push_back(cur);
+    }
+    return rects;
+}
+
+// Minimal decoder along the lines of PL_smallEPD::applyPatches()
+struct Reader {
+    const std::vector<uint8_t> *data;
+    size_t pos;
+};
+
+static int readByte(void *ctx) {
+    Reader *r = (Reader *)ctx;
+    return r->pos < r->data->size() ? (*r->data)[r->pos++] : -1;
+}
+
+static bool applyPatch(const std::vector<uint8_t> &patch, uint8_t *frame) {
+    Reader rd = {&patch, 0};
+    uint8_t row[STRIDE];
+
+    for (;;) {
+        int op = readByte(&rd);
+        if (op == EPD_PATCH_END) return true;
+        if (op == EPD_PATCH_UPDATE) return readByte(&rd) >= 0;
+        if ((op != EPD_PATCH_RECT) || (rd.pos + 9 > patch.size())) return false;
+
+        const uint8_t *h = &patch[rd.pos];
+        int x = h[0] | h[1] << 8, y = h[2] | h[3] << 8, w = h[4] | h[5] << 8, n = h[6] | h[7] << 8;
+        rd.pos += 9;
+        if ((x % 4) || (w % 4) || (x + w > WIDTH) || (y + n > HEIGHT)) return false;
+
+        PL_smallRLE rle;
+        rle.begin(readByte, &rd);
+        for (int i = 0; i < n; i++) {
+            if (rle.read(row, w / 4) != w / 4) return false;
+            memcpy(frame + (y + i) * STRIDE + x / 4, row, w / 4);
+        }
+    }
+}
+
+int main(int argc, char **argv) {
+    int mode = EPD_PATCH_NONE, plane = EPD_PATCH_NOPLANE, gap = 2;
+    int i = 1;
+    for (; i < argc - 1 && argv[i][0] == '-'; i += 2) {
+        if (!strcmp(argv[i], "-m")) mode = atoi(argv[i + 1]);
+        else if (!strcmp(argv[i], "-p")) plane = atoi(argv[i + 1]);
+        else if (!strcmp(argv[i], "-g")) gap = atoi(argv[i + 1]);
+        else break;
+    }
+    if ((argc - i != 3) || (mode < EPD_PATCH_NONE) || (mode > 2) || (plane < 0) || (plane > 0xFF)) {
+        fprintf(stderr, "usage: %s [-m mode] [-p plane] [-g gap] <old.bin> <new.bin> <patch.bin>\n", argv[0]);
+        return 1;
+    }
+
+    static uint8_t before[PLANE_SIZE], after[PLANE_SIZE], check[PLANE_SIZE];
+    if (!loadFrame(argv[i], before) || !loadFrame(argv[i + 1], after)) {
+        fprintf(stderr, "cannot read frames %s, %s\n", argv[i], argv[i + 1]);
+        return 1;
+    }
+
+    std::vector<Rect> rects = diffFrames(before, after, gap);
+    std::vector<uint8_t> patch, full;
+    for (size_t k = 0; k < rects.size(); k++) encodeRect(patch, after, rects[k], plane);
+    if (!rects.empty()) {
+        Rect all = {0, 0, STRIDE, HEIGHT};
+        encodeRect(full, after, all, plane);
+        if (full.size() < patch.size()) {
+            patch.swap(full);
+            rects.assign(1, all);
+        }
+    }
+    if (mode == EPD_PATCH_NONE) patch.push_back(EPD_PATCH_END);
+    else {
+        patch.push_back(EPD_PATCH_UPDATE);
+        patch.push_back(mode);
+    }
+
+    memcpy(check, before, PLANE_SIZE);
+    if (!applyPatch(patch, check) || memcmp(check, after, PLANE_SIZE)) {
+        fprintf(stderr, "verification failed\n");
+        return 1;
+    }
+
+    FILE *f = fopen(argv[i + 2], "wb");
+    if (!f || (fwrite(&patch[0], 1, patch.size(), f) != patch.size())) {
+        fprintf(stderr, "cannot write %s\n", argv[i + 2]);
+        return 1;
+    }
+    fclose(f);
+
+    for (size_t k = 0; k < rects.size(); k++)
+        printf("rect %3d,%3d %3dx%3d\n", rects[k].x * 4, rects[k].y, rects[k].w * 4, rects[k].h);
+    printf("%u rects, %u bytes (frame %u bytes)\n", (unsigned)rects.size(), (unsigned)patch.size(),
+        (unsigned)PLANE_SIZE);
+    return 0;
+}
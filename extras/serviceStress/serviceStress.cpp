@@ -0,0 +1,91 @@
+/* *****************************************************************************************
+serviceStress - Host stress test for PL_smallService / PL_smallQueue using the std::thread
+backend. Several producer threads submit numbered pixel commands as fast as they can
+(retrying when the queue is full) while a mock display sleeps through every "waveform".
+Checks that every command is applied exactly once and in order per producer, and reports
+how long a single submit() took at worst. Build & run from this folder:
+
+    g++ -O2 -std=c++11 -pthread -I../../src serviceStress.cpp -o serviceStress
+    ./serviceStress [producers] [commands per producer]
+
+Released under BSD license (3-clause BSD license), check license.md for more information.
+***************************************************************************************** */
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+#include <chrono>
+#include <thread>
+
+#define EPD_UPD_FULL  0x00
+#define EPD_UPD_PART  0x01
+#define EPD_UPD_MONO  0x02
+
+#include "PL_smallService.h"
+
+#define MAXPRODUCERS 16
+
+// Mock display: producer id in x, sequence number in y (mod 32768)
+struct MockEPD {
+    long lastSeq[MAXPRODUCERS];
+    long applied = 0, errors = 0, updates = 0;
+
+    MockEPD() { for (int i = 0; i < MAXPRODUCERS; i++) lastSeq[i] = -1; }
+    void drawPixel(int16_t x, int16_t y, uint16_t) {
+        if (y != (lastSeq[x] + 1) % 32768) errors++;        // lost, doubled or reordered
+        lastSeq[x] = y;
+        applied++;
+    }
+    void fillRect(int16_t, int16_t, int16_t, int16_t, uint16_t) {}
+    void drawLine(int16_t, int16_t, int16_t, int16_t, uint16_t) {}
+    void setCursor(int16_t, int16_t) {}
+    void setTextColor(uint16_t) {}
+    void print(const char *) {}
+    void clear(uint8_t) {}
+    void update(int) {
+        updates++;
+        std::this_thread::sleep_for(std::chrono::milliseconds(25));   // shortened waveform
+    }
+};
+
+int main(int argc, char **argv) {
+    int producers = argc > 1 ? atoi(argv[1]) : 4;
+    long n = argc > 2 ? atol(argv[2]) : 2000;
+    if (producers > MAXPRODUCERS) producers = MAXPRODUCERS;
+
+    MockEPD epd;
+    PL_smallService<MockEPD> service(epd);
+    service.begin(EPD_UPD_PART, 1, 1);
+
+    std::vector<std::thread> threads;
+    std::vector<long> accepted(producers, 0);
+    std::vector<double> worstUs(producers, 0);
+    for (int p = 0; p < producers; p++)
+        threads.push_back(std::thread([&, p]() {
+            while (accepted[p] < n) {
+                auto t0 = std::chrono::steady_clock::now();
+                bool ok = service.pixel(p, (int16_t)(accepted[p] % 32768), 0);
+                double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+                if (us > worstUs[p]) worstUs[p] = us;
+                if (ok) accepted[p]++;
+                else std::this_thread::yield();
+            }
+        }));
+    for (auto &t : threads) t.join();
+
+    long total = 0;
+    for (int p = 0; p < producers; p++) total += accepted[p];
+    while ((long)service.getCommands() < total)
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    service.end();
+
+    double worst = 0;
+    for (int p = 0; p < producers; p++) if (worstUs[p] > worst) worst = worstUs[p];
+    printf("producers %d, accepted %ld, rejected (queue full) %lu\n", producers, total,
+        service.getDropped());
+    printf("applied %ld, batches %lu, order errors %ld, worst submit %.1f us\n", epd.applied,
+        service.getBatches(), epd.errors, worst);
+
+    bool ok = (total == producers * n) && (epd.applied == total) && (epd.errors == 0);
+    printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
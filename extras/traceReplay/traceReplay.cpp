@@ -0,0 +1,209 @@
+/* *****************************************************************************************
+traceReplay - Host tool for SPI traces recorded with EPD_TRACE and printed by dumpTrace().
+The records are replayed against an emulated UC8156 register file and summarized: time
+and bytes per register, redundant register writes and image uploads (same content as
+already in the controller) and the cost of every waveform pass, grouped by the voltage
+setup in use (for Legio this is what tells the pigment passes apart). Lines not starting
+with "EPDT" are ignored, so a raw Serial log can be fed in. Build & run:
+
+    g++ -O2 -std=c++11 traceReplay.cpp -o traceReplay
+    ./traceReplay serial.log        (or: ./traceReplay < serial.log)
+
+Released under BSD license (3-clause BSD license), check license.md for more information.
+***************************************************************************************** */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <map>
+
+struct Record {
+    unsigned long time, busy;
+    char type;
+    int reg, n, bytes;
+    int val[4];
+};
+
+struct Stat {
+    long count = 0, bytes = 0, redundant = 0;
+    double us = 0, busyUs = 0;
+};
+
+struct Pass {
+    long count = 0, bytes = 0;
+    double us = 0, driveUs = 0;
+};
+
+static const char *regName(int reg) {
+    switch (reg) {
+        case 0x01: return "PANELSETTING";
+        case 0x02: return "DRIVERVOLTAGE";
+        case 0x03: return "POWERCONTROL";
+        case 0x04: return "BOOSTSETTING";
+        case 0x06: return "TCOMTIMING";
+        case 0x07: return "INTTEMPERATURE";
+        case 0x08: return "TEMPERATURE";
+        case 0x0C: return "SETRESOLUTION";
+        case 0x0D: return "WRITEPXRECTSET";
+        case 0x0E: return "PIXELACESSPOS";
+        case 0x0F: return "DATENTRYMODE";
+        case 0x10: return "WRITE RAM";
+        case 0x14: return "DISPLAYENGINE";
+        case 0x15: return "PUMP STATUS";
+        case 0x18: return "VCOMCONFIG";
+        case 0x1B: return "TPCOM";
+        case 0x1D: return "BORDERSETTING";
+        case 0x1F: return "POWERSEQUENCE";
+        case 0x20: return "SOFTWARERESET";
+        case 0x21: return "DEEPSLEEP";
+        case 0x40: return "PROGRAMMTP";
+        case 0x41: return "MTPADDRESS";
+        case 0x43: return "MTP READ";
+        case 0x44: return "LOADMONOWF";
+    }
+    return "?";
+}
+
+// Registers which trigger an action instead of holding a setting
+static bool isCommand(int reg) {
+    return reg == 0x03 || reg == 0x14 || reg == 0x20 || reg == 0x21;
+}
+
+static bool parse(const char *line, Record &r) {
+    char type;
+    long t, b;
+    int reg, v[4], bytes;
+    if (sscanf(line, "EPDT,%ld,%c,%d,%d,%d,%d,%d,%d,%ld", &t, &type, &reg, &v[0], &v[1], &v[2],
+            &v[3], &bytes, &b) != 9)
+        return false;
+    r.time = t; r.type = type; r.reg = reg; r.bytes = bytes; r.busy = b;
+    r.n = 0;
+    for (int i = 0; i < 4; i++)
+        if (v[i] >= 0) r.val[r.n++] = v[i];
+    return true;
+}
+
+// Source voltage and TPCOM as written by PL_smallLegio::setSourceVoltage() / setTPCOM()
+static std::string passKey(std::map<int, std::vector<int> > &regs, int mtp) {
+    char s[64];
+    int sv = -1, tp = 0;
+    if (regs[0x02].size() > 1)
+        sv = (regs[0x02][1] & 0x0F) / 2 + 8;
+    if (regs[0x1B].size() > 1) {
+        int raw = regs[0x1B][0] | (regs[0x1B][1] & 0x03) << 8;
+        tp = (regs[0x1B][1] & 0x04) ? -raw * 30 - 2800 : raw * 30 - 2800;
+    }
+    snprintf(s, sizeof(s), "%s Vs=%2dV TPCOM=%+6dmV", mtp == 2 ? "mono" : "4 GL", sv, tp);
+    return s;
+}
+
+int main(int argc, char **argv) {
+    FILE *f = argc > 1 ? fopen(argv[1], "r") : stdin;
+    if (!f) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    std::vector<Record> recs;
+    char line[256];
+    while (fgets(line, sizeof(line), f)) {
+        Record r;
+        if (parse(line, r))
+            recs.push_back(r);
+    }
+    if (recs.empty()) {
+        fprintf(stderr, "no EPDT records found\n");
+        return 1;
+    }
+
+    std::map<int, std::vector<int> > regs;          // emulated register file
+    std::map<int, Stat> stats;
+    std::map<std::string, Pass> passes;
+    long checksum[2] = { -1, -1 };                  // image / previous image RAM
+    long totalBytes = 0, redundant = 0, redundantBytes = 0, drives = 0;
+    unsigned long passStart = recs[0].time;
+    long passBytes = 0;
+
+    for (size_t i = 0; i < recs.size(); i++) {
+        Record &r = recs[i];
+        double us = (i + 1 < recs.size()) ? (double)(recs[i + 1].time - r.time) : r.busy;
+        int key = (r.type == 'R') ? 0x100 | r.reg : (r.type == 'E') ? 0x200 : r.reg;
+        Stat &s = stats[key];
+        s.count++;
+        s.us += us;
+        s.busyUs += r.busy;
+
+        if (r.type == 'W') {
+            int bytes = 1 + r.n;
+            s.bytes += bytes;
+            totalBytes += bytes;
+            passBytes += bytes;
+            std::vector<int> v(r.val, r.val + r.n);
+            if (!isCommand(r.reg) && regs.count(r.reg) && regs[r.reg] == v) {
+                s.redundant++;
+                redundant++;
+                redundantBytes += bytes;
+            }
+            regs[r.reg] = v;
+            if (r.reg == 0x20) {                    // software reset forgets everything
+                regs.clear();
+                checksum[0] = checksum[1] = -1;
+            }
+        } else if (r.type == 'R') {
+            s.bytes += 2;
+            totalBytes += 2;
+            passBytes += 2;
+        } else if (r.type == 'B') {
+            int prev = (r.n > 2) ? r.val[2] : 0;
+            long sum = (r.n > 1) ? (r.val[0] | r.val[1] << 8) : -2;
+            s.bytes += r.bytes + 1;
+            totalBytes += r.bytes + 1;
+            passBytes += r.bytes + 1;
+            if (checksum[prev] == sum) {
+                s.redundant++;
+                redundant++;
+                redundantBytes += r.bytes + 1;
+            }
+            checksum[prev] = sum;
+        } else if (r.type == 'E') {
+            drives++;
+            Pass &p = passes[passKey(regs, regs[0x40].empty() ? 0 : regs[0x40][0])];
+            p.count++;
+            p.bytes += passBytes;
+            p.us += (double)(r.time + r.busy - passStart);
+            p.driveUs += r.busy;
+            passStart = r.time + r.busy;
+            passBytes = 0;
+            // after a waveform the image RAM becomes the previous image
+            checksum[1] = checksum[0];
+        }
+    }
+
+    double total = (double)(recs.back().time + recs.back().busy - recs[0].time);
+    printf("%zu records, %.1f ms, %ld bytes over SPI, %ld waveforms\n\n", recs.size(),
+        total / 1000, totalBytes, drives);
+
+    printf("%-4s %-16s %7s %9s %10s %10s %9s\n", "reg", "name", "count", "bytes", "time ms",
+        "busy ms", "redundant");
+    for (auto &it : stats) {
+        Stat &s = it.second;
+        printf("%c%02X  %-16s %7ld %9ld %10.2f %10.2f %9ld\n", (it.first & 0x200) ? 'e' :
+            (it.first & 0x100) ? 'r' : 'w', it.first & 0xFF,
+            (it.first & 0x200) ? "(waveform)" : regName(it.first & 0xFF), s.count, s.bytes, s.us / 1000,
+            s.busyUs / 1000, s.redundant);
+    }
+    printf("\nredundant: %ld transfers, %ld bytes (%.1f%% of all bytes)\n", redundant,
+        redundantBytes, totalBytes ? 100.0 * redundantBytes / totalBytes : 0.0);
+
+    if (!passes.empty()) {
+        printf("\n%-32s %6s %10s %10s %10s %10s\n", "waveform pass setup", "passes", "bytes",
+            "total ms", "drive ms", "ms/pass");
+        for (auto &it : passes) {
+            Pass &p = it.second;
+            printf("%-32s %6ld %10ld %10.1f %10.1f %10.1f\n", it.first.c_str(), p.count, p.bytes,
+                p.us / 1000, p.driveUs / 1000, p.us / 1000 / p.count);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,41 @@
+/* *****************************************************************************************
+PL_smallEPD - A library for 1.1”, 1.4", 2.1" and 3.1" E-Paper displays (EPDs) from 
+Plastic Logic based on UC8156 driver IC for Adafruit GFX core library. The communication is 
+SPI-based, for more information about hook-up please check: https://github.com/plasticlogic.
+
+Created by Robert Poser, Mar 30th 2021, Dresden/Germany. Released under BSD license
+(3-clause BSD license), check license.md for more information.
+
+We invested time and resources providing this open source code, please support Plasticlogic 
+and open source hardware by purchasing this product @Plasticlogic
+***************************************************************************************** */
+#ifndef PL_smallBundle_h
+#define PL_smallBundle_h
+
+// Image bundle, one PROGMEM blob holding many images (built by extras/bundlePacker).
+// All numbers little endian, offsets counted from the start of the bundle:
+//
+//   header   "PLB1", uint16 image count, uint16 plane record count
+//   index    one entry per image, the image ID is its position:
+//            char name[16], uint8 flags (like byte 3 of an image: 0x80 BW, 0x40 yellow,
+//            0x20 green, 0x10 red, 0x08 blue), uint8 reserved, uint16 record[5]
+//   records  one per distinct plane: uint32 offset, uint16 length, uint8 encoding,
+//            uint8 reserved
+//   data     the plane contents, raw or run length coded (see PL_smallRLE.h)
+//
+// Identical planes of different images share one record, color planes without pigment
+// are not stored at all (flag cleared, record EPD_BUNDLE_NOPLANE). A flagged BW plane is
+// always kept, even if plain white, as its pass is the one driving the background.
+
+#define EPD_BUNDLE_MAGIC      "PLB1"
+#define EPD_BUNDLE_HEADER     8
+#define EPD_BUNDLE_NAMELEN    16
+#define EPD_BUNDLE_ENTRY      28
+#define EPD_BUNDLE_RECORD     8
+#define EPD_BUNDLE_PLANES     5
+
+#define EPD_BUNDLE_RAW        0x00
+#define EPD_BUNDLE_RLE        0x01
+#define EPD_BUNDLE_NOPLANE    0xFFFF
+
+#endif
@@ -0,0 +1,126 @@
+/* *****************************************************************************************
+PL_smallEPD - A library for 1.1”, 1.4", 2.1" and 3.1" E-Paper displays (EPDs) from 
+Plastic Logic based on UC8156 driver IC for Adafruit GFX core library. The communication is 
+SPI-based, for more information about hook-up please check: https://github.com/plasticlogic.
+
+Created by Robert Poser, Mar 30th 2021, Dresden/Germany. Released under BSD license
+(3-clause BSD license), check license.md for more information.
+
+We invested time and resources providing this open source code, please support Plasticlogic 
+and open source hardware by purchasing this product @Plasticlogic
+***************************************************************************************** */
+#include "PL_smallDither.h"
+#include <string.h>
+
+static const int8_t bayer[4][4] = {                 // Threshold offsets, -15..15 / 32 step
+    { -15,   1, -11,   5 },
+    {   7,  -9,  11,  -5 },
+    {  -9,   9, -13,   3 },
+    {  13,  -3,   9,  -7 }
+};
+
+// Nominal sRGB of the Legio pigments, index equals the EPD_BLACK..EPD_BLUE color code
+static const uint8_t palette[6][4] = {
+    { 0x00,   0,   0,   0 },                        // EPD_BLACK
+    { 0x03, 255, 255, 255 },                        // EPD_WHITE
+    { 0x04, 255, 220,   0 },                        // EPD_YELLOW
+    { 0x05,  40, 160,  60 },                        // EPD_GREEN
+    { 0x06, 220,  30,  30 },                        // EPD_RED
+    { 0x07,  30,  60, 200 }                         // EPD_BLUE
+};
+
+static inline uint8_t quantize(int v) {             // 8 bit -> EPD_BLACK..EPD_WHITE
+    return v < 43 ? 0 : v < 128 ? 1 : v < 213 ? 2 : 3;
+}
+
+static inline int clamp(int v) {
+    return v < 0 ? 0 : v > 255 ? 255 : v;
+}
+
+// ************************************************************************************
+// BEGIN - Selects the dithering MODE and resets the error line for a new image which
+// is WIDTH pixels wide (at most EPD_DITHER_MAXWIDTH). Rows are then fed top to bottom.
+// ************************************************************************************
+void PL_smallDither::begin(uint8_t mode, int16_t width) {
+    _mode  = mode;
+    _width = width > EPD_DITHER_MAXWIDTH ? EPD_DITHER_MAXWIDTH : width;
+    _y     = 0;
+    memset(err, 0, sizeof(err));
+}
+
+// ************************************************************************************
+// GRAYROW - Quantizes one row of 8 bit grey values (0 = black) to the four grey levels
+// and writes them packed (2 bit per pixel, first pixel in the MSB) into DST starting
+// at pixel X0, i.e. DST can directly point to the start of a row in the image buffer.
+// Errors are kept in 1/16 steps, so the Floyd-Steinberg weights stay integer.
+// ************************************************************************************
+void PL_smallDither::grayRow(const uint8_t *gray, uint8_t *dst, int16_t x0) {
+    int16_t *e = err[0];
+    int right = 0, down = 0, downRight = 0;
+
+    for (int x = 0; x < _width; x++) {
+        uint8_t q;
+        if (_mode == EPD_DITHER_FS) {
+            int v16 = gray[x] * 16 + e[x + 1] + right;
+            q = quantize(clamp((v16 + 8) >> 4));
+            int d = v16 - q * 85 * 16;              // error in 1/16 steps
+            right    = (d * 7) / 16;
+            e[x]     = down + (d * 3) / 16;         // column x-1 of the next row is final
+            down     = downRight + (d * 5) / 16;
+            downRight = d / 16;
+        } else {
+            q = quantize(clamp(gray[x] + bayer[_y & 3][x & 3] * 85 / 32));
+        }
+        int px = x0 + x;
+        int shift = 6 - 2 * (px & 3);
+        dst[px >> 2] = (dst[px >> 2] & ~(0x03 << shift)) | (q << shift);
+    }
+    e[_width] = down;
+    _y++;
+}
+
+// ************************************************************************************
+// RGBROW - Maps one row of 8 bit RGB triplets to the nearest Legio pigment and writes
+// one color code (EPD_BLACK, EPD_WHITE, EPD_YELLOW..EPD_BLUE) per pixel into DST.
+// ************************************************************************************
+void PL_smallDither::rgbRow(const uint8_t *rgb, uint8_t *dst) {
+    int right[3] = { 0, 0, 0 }, down[3] = { 0, 0, 0 }, downRight[3] = { 0, 0, 0 };
+
+    for (int x = 0; x < _width; x++) {
+        int v[3], v16[3];
+        for (int c = 0; c < 3; c++) {
+            if (_mode == EPD_DITHER_FS) {
+                v16[c] = rgb[x * 3 + c] * 16 + err[c][x + 1] + right[c];
+                v[c] = clamp((v16[c] + 8) >> 4);
+            } else
+                v[c] = clamp(rgb[x * 3 + c] + bayer[_y & 3][x & 3] * 85 / 32);
+        }
+
+        int best = 0;
+        long bestDist = 0x7FFFFFFF;
+        for (int i = 0; i < 6; i++) {
+            long dist = 0;
+            for (int c = 0; c < 3; c++) {
+                int d = v[c] - palette[i][c + 1];
+                dist += (long)d * d;
+            }
+            if (dist < bestDist) {
+                bestDist = dist;
+                best = i;
+            }
+        }
+        dst[x] = palette[best][0];
+
+        if (_mode == EPD_DITHER_FS)
+            for (int c = 0; c < 3; c++) {
+                int d = v16[c] - palette[best][c + 1] * 16;
+                right[c]     = (d * 7) / 16;
+                err[c][x]    = down[c] + (d * 3) / 16;
+                down[c]      = downRight[c] + (d * 5) / 16;
+                downRight[c] = d / 16;
+            }
+    }
+    for (int c = 0; c < 3; c++)
+        err[c][_width] = down[c];
+    _y++;
+}
@@ -0,0 +1,35 @@
+/* *****************************************************************************************
+PL_smallEPD - A library for 1.1”, 1.4", 2.1" and 3.1" E-Paper displays (EPDs) from 
+Plastic Logic based on UC8156 driver IC for Adafruit GFX core library. The communication is 
+SPI-based, for more information about hook-up please check: https://github.com/plasticlogic.
+
+Created by Robert Poser, Mar 30th 2021, Dresden/Germany. Released under BSD license
+(3-clause BSD license), check license.md for more information.
+
+We invested time and resources providing this open source code, please support Plasticlogic 
+and open source hardware by purchasing this product @Plasticlogic
+***************************************************************************************** */
+#ifndef PL_smallDither_h
+#define PL_smallDither_h
+
+#include <stdint.h>                 // No Arduino dependencies, builds on the host as well
+
+#define EPD_DITHER_ORDERED  0x00    // 4x4 Bayer matrix, stateless
+#define EPD_DITHER_FS       0x01    // Floyd-Steinberg, one error line per channel
+
+#define EPD_DITHER_MAXWIDTH 240
+
+class PL_smallDither {
+
+public:
+    void begin(uint8_t mode=EPD_DITHER_FS, int16_t width=EPD_DITHER_MAXWIDTH);
+    void grayRow(const uint8_t *gray, uint8_t *dst, int16_t x0=0);
+    void rgbRow(const uint8_t *rgb, uint8_t *dst);
+
+private:
+    uint8_t _mode;
+    int16_t _width, _y;
+    int16_t err[3][EPD_DITHER_MAXWIDTH + 2];
+};
+
+#endif
@@ -11,12 +11,32 @@ and open source hardware by purchasing this product @Plasticlogic
 ***************************************************************************************** */
 #include "PL_smallEPD.h"
 
+#if EPD_TRACE > 0
+#define TRACE_START(t)          uint32_t t = micros()
+#define TRACE(...)              trace(__VA_ARGS__)
+#else
+#define TRACE_START(t)
+#define TRACE(...)
+#endif
+
+// Default update profile: one band keeping the original constants at any temperature.
+// Tuned bands for a particular panel are set with setUpdateProfiles().
+static const EPD_updateProfile defaultProfiles[] = {
+    { -128, 0, 0, 1, true }
+};
+
 PL_smallEPD::PL_smallEPD(int8_t _cs, int8_t _rst, int8_t _busy) : Adafruit_GFX(EPD_WIDTH, 
 EPD_HEIGHT) {
 
     cs      = _cs;
     rst     = _rst;
     busy    = _busy;
+    _profiles     = defaultProfiles;
+    _profileCount = sizeof(defaultProfiles) / sizeof(defaultProfiles[0]);
+}
+
+PL_smallEPD::~PL_smallEPD() {
+    free(_trace);
 }
 
 // PUBLIC
@@ -30,17 +50,9 @@ void PL_smallEPD::begin(int8_t BGcolor) {
     if (busy!=-1)
         pinMode(busy, INPUT);
 
-    if (rst!=-1) {
-        pinMode(rst, OUTPUT);                   //Trigger a global hardware reset...
-        digitalWrite(rst, HIGH);  
-        delay(5);   
-        digitalWrite(rst, LOW);
-        delay(5);        
-        digitalWrite(rst, HIGH);
-        delay(5);        
-        waitForBusyInactive();
-    } else
-        writeRegister(EPD_SOFTWARERESET, -1, -1, -1, -1);    //... or do software reset if no pin defined
+    if (rst!=-1)
+        pinMode(rst, OUTPUT);
+    reset();
 
     _EPDsize=getEPDsize();                                  //Read NVM to determine display size
     switch (_EPDsize) {
@@ -61,11 +73,6 @@ void PL_smallEPD::begin(int8_t BGcolor) {
   */      case 21:
             _width=146; _height=240; nextline= _width/4; _buffersize=_width*_height/4;
             width=240; height=146;
-            writeRegister(EPD_PANELSETTING, 0x10, -1, -1, -1);        
-            writeRegister(EPD_WRITEPXRECTSET, 0, 239, 0, 145);  //147?
-            //writeRegister(EPD_VCOMCONFIG, 0x00, 0x00, 0x24, 0x07);
-            writeRegister(EPD_VCOMCONFIG, 0x00, 0x00, 0x24, 0x05);
-
             break;
   /*      case 31:
             _width=76; _height=312; nextline= _width/4; _buffersize=_width*_height/4;
@@ -74,46 +81,98 @@ void PL_smallEPD::begin(int8_t BGcolor) {
             writeRegister(EPD_WRITEPXRECTSET, 0, 0x97, 0, 0x9b);  
             writeRegister(EPD_VCOMCONFIG, 0x50, 0x01, 0x24, 0x07);
   */  }
-   // writeRegister(0x1B, 0xA7, 0x04, -1, -1);
-    writeRegister(EPD_DRIVERVOLTAGE, 0x25, 0xff, -1, -1);
-    writeRegister(EPD_BORDERSETTING, 0x04, -1, -1, -1);
-    writeRegister(EPD_LOADMONOWF, 0x60, -1, -1, -1);
-    writeRegister(EPD_INTTEMPERATURE, 0x0A, -1, -1, -1);
-    writeRegister(EPD_BOOSTSETTING, 0x22, 0x17, -1, -1);
+    configure();
 
     setRotation(1);                             //Set landscape mode as default
-    clearScreen(BGcolor);                   //Start with a white refresh if TRUE
+    if (!restoreSnapshot())                     //Content of the last run still on the glass?
+        clearScreen(BGcolor);                   //Start with a white refresh if TRUE
     setTextColor(EPD_BLACK);                    //Set text color to black as default
 }
 
+// ************************************************************************************
+// WAKE - Fast way back from deepSleep(): the UC8156 is reset via the RST pin and only
+// the configuration cached since begin() is written again. Neither the MTP is read nor
+// the screen cleared, the content stays on the glass. With RESTORE (default) the image
+// last sent (buffer2) goes back to the UC8156 as previous image, so the next
+// EPD_UPD_PART/_MONO only drives the pixels changed since the last update.
+// Falls back to begin() if the display was never initialised. Without RST pin a
+// sleeping UC8156 cannot be woken up (SPI is ignored), then nothing is done and FALSE
+// returned.
+// ************************************************************************************
+bool PL_smallEPD::wake(bool restore) {
+    if (_EPDsize == 0) {
+        begin();
+        return true;
+    }
+    if (rst == -1)
+        return false;
+    reset();
+    configure();
+    if (restore)
+        writeBuffer(true);
+    return true;
+}
+
+// ************************************************************************************
+// SETFRAMESTORE - Optional persistence of the displayed frame, call before begin(). READ
+// and WRITE access SIZE bytes of any non-volatile memory (EEPROM, flash, RTC memory)
+// via the user supplied functions. After every update() or completed present() a
+// snapshot is written, but only if the content changed: a hash, the update count, the
+// Legio planes in use and, if it fits, the run length coded image as last sent to the
+// UC8156. On the next begin() a valid snapshot replaces clearScreen(): the image is
+// handed back to the UC8156 as previous image and the first update() or present() is
+// skipped if nothing changed, or only drives the difference. With a hash-only snapshot
+// that update is a full one.
+// ************************************************************************************
+void PL_smallEPD::setFrameStore(EPD_storeRead read, EPD_storeWrite write, void *ctx, uint32_t size) {
+    _storeRead  = read;
+    _storeWrite = write;
+    _storeCtx   = ctx;
+    _storeSize  = size;
+}
+
+bool PL_smallEPD::isRestored() {
+    return _wasRestored;
+}
+
+byte PL_smallEPD::getRestoredPlanes() {
+    return _wasRestored ? _planes : 0;
+}
+
+uint32_t PL_smallEPD::getUpdateCount() {
+    return _updateCount;
+}
+
 // ************************************************************************************
 // CLEAR - Erases the image buffer and triggers an image update and sets the cursor
-// back to the origin coordinates (0,0).
+// back to the origin coordinates (0,0). With B2 only buffer2 is filled instead, e.g.
+// for writeToPreviousBuffer(); otherwise buffer2 keeps the image last sent. B2 would
+// overwrite a frame parked by present(), so let poll() finish that first.
 // ************************************************************************************
 void PL_smallEPD::clear(byte c, bool b2) {
   switch (c) {
     case EPD_WHITE:
       for (int i=0; i<_buffersize; i++) {
           if (!b2) buffer[i] = 0xff;
-          buffer2[i] = 0xff;
+          else buffer2[i] = 0xff;
       }
       break;
     case EPD_LGRAY:
       for (int i=0; i<_buffersize; i++) {
           if (!b2) buffer[i] = 0xaa;
-          buffer2[i] = 0xaa;
+          else buffer2[i] = 0xaa;
       }
       break;
     case EPD_DGRAY:
       for (int i=0; i<_buffersize; i++) {
           if (!b2) buffer[i] = 0x55;
-          buffer2[i] = 0x55;
+          else buffer2[i] = 0x55;
       }
       break;
     case EPD_BLACK:
       for (int i=0; i<_buffersize; i++) {
           if (!b2) buffer[i] = 0x00;
-          buffer2[i] = 0x00;
+          else buffer2[i] = 0x00;
       }
       break;
     }
@@ -127,6 +186,8 @@ void PL_smallEPD::clear(byte c, bool b2) {
 void PL_smallEPD::clearScreen(int8_t BGcolor) {
     clear();
     if (BGcolor>=0) {
+        _restored = 0;                          //Glass content is known from now on
+        _hold = true;                           //Store only the final frame
         if (BGcolor == EPD_BLACK)
             invert();
         update();
@@ -134,6 +195,9 @@ void PL_smallEPD::clearScreen(int8_t BGcolor) {
         update();
         invert();
         update();       
+        _hold = false;
+        _frameHash = hashBytes(buffer, _buffersize);
+        saveSnapshot(true);
     }
 }
 
@@ -192,6 +256,150 @@ void PL_smallEPD::invert(bool b2) {
             buffer[i] = ~buffer[i];
 }
 
+// ************************************************************************************
+// RASTER OPS - Region kernels working on the packed buffer instead of single pixels.
+// Each row is split into an edge byte on either side and 32 bit words in between, the
+// edges are merged through a pixel mask. A level compare yields one bit per pixel in
+// the low bit of its pair (the 0x55 positions), which is multiplied by the new level
+// for remaps or counted for statistics. The rectangle is clipped to the screen.
+// ************************************************************************************
+#define EPD_LANES   0x55555555UL
+
+static inline uint32_t levelMask(uint32_t v, byte level) {
+    uint32_t t = v ^ (level * EPD_LANES);
+    return ~(t | (t >> 1)) & EPD_LANES;
+}
+
+struct invertOp {
+    uint32_t operator()(uint32_t v, uint32_t) { return ~v; }
+};
+
+struct remapOp {
+    byte lut[4];
+    uint32_t operator()(uint32_t v, uint32_t) {
+        uint32_t r = 0;
+        for (byte k = 0; k < 4; k++)
+            if (lut[k]) r |= levelMask(v, k) * lut[k];
+        return r;
+    }
+};
+
+struct countOp {
+    long *counts;
+    uint32_t operator()(uint32_t v, uint32_t m) {
+        for (byte k = 0; k < 4; k++) counts[k] += __builtin_popcountl(levelMask(v, k) & m);
+        return v;
+    }
+};
+
+template<class Op> static void rasterRow(byte *row, int16_t x, int16_t w, Op &op) {
+    int b0 = x / 4, b1 = (x + w - 1) / 4;
+    byte m0 = 0xFF >> (2 * (x % 4)), m1 = 0xFF << (2 * (3 - (x + w - 1) % 4));
+    uint32_t v;
+
+    if (b0 == b1) m0 &= m1;
+    v = row[b0];
+    row[b0] = (v & ~m0) | (op(v, m0) & m0);
+    if (b0 == b1) return;
+
+    int i = b0 + 1;
+    for (; i + 4 <= b1; i += 4) {
+        memcpy(&v, row + i, 4);
+        v = op(v, 0xFFFFFFFFUL);
+        memcpy(row + i, &v, 4);
+    }
+    for (; i < b1; i++) {
+        v = row[i];
+        row[i] = op(v, 0xFF);
+    }
+    v = row[b1];
+    row[b1] = (v & ~m1) | (op(v, m1) & m1);
+}
+
+bool PL_smallEPD::clipRect(int16_t &x, int16_t &y, int16_t &w, int16_t &h) {
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > _width) w = _width - x;
+    if (y + h > _height) h = _height - y;
+    return (w > 0) && (h > 0);
+}
+
+byte *PL_smallEPD::rowStart(int16_t y) {
+    if (_EPDsize==11 || _EPDsize==3)                    // same offset as drawPixel()
+        y=y+3;
+    return &buffer[y * nextline];
+}
+
+// Inverts all pixels of the rectangle, e.g. to highlight a selection
+void PL_smallEPD::invertRect(int16_t x, int16_t y, int16_t w, int16_t h) {
+    invertOp op;
+    if (!clipRect(x, y, w, h)) return;
+    for (int16_t r = y; r < y + h; r++) rasterRow(rowStart(r), x, w, op);
+}
+
+// Replaces every grey level c of the rectangle by LUT[c], e.g. {EPD_LGRAY, EPD_LGRAY,
+// EPD_LGRAY, EPD_WHITE} dims everything but the background
+void PL_smallEPD::remapRect(int16_t x, int16_t y, int16_t w, int16_t h, const byte lut[4]) {
+    remapOp op;
+    for (byte k = 0; k < 4; k++) op.lut[k] = lut[k] & 0x03;
+    if (!clipRect(x, y, w, h)) return;
+    for (int16_t r = y; r < y + h; r++) rasterRow(rowStart(r), x, w, op);
+}
+
+// Pixels at least as light as LEVEL turn white, all others black, as needed for
+// EPD_UPD_MONO updates
+void PL_smallEPD::thresholdRect(int16_t x, int16_t y, int16_t w, int16_t h, byte level) {
+    byte lut[4];
+    for (byte k = 0; k < 4; k++) lut[k] = (k >= level) ? EPD_WHITE : EPD_BLACK;
+    remapRect(x, y, w, h, lut);
+}
+
+// Sets all pixels to COLOR whose bit is set in the 1 bit stencil MASK, which has W x H
+// pixels, the first one in the MSB, and (W+7)/8 bytes per row
+void PL_smallEPD::maskRect(int16_t x, int16_t y, int16_t w, int16_t h, const byte *mask,
+        byte color) {
+    static const byte spread[16] = {                    // 4 stencil bits to 4 pixels
+        0x00, 0x03, 0x0C, 0x0F, 0x30, 0x33, 0x3C, 0x3F,
+        0xC0, 0xC3, 0xCC, 0xCF, 0xF0, 0xF3, 0xFC, 0xFF};
+    int16_t x0 = x, y0 = y, stride = (w + 7) / 8;
+    uint32_t fill = (color & 0x03) * EPD_LANES;
+
+    if (!clipRect(x, y, w, h)) return;
+    int b0 = x / 4, b1 = (x + w - 1) / 4;
+    byte m0 = 0xFF >> (2 * (x % 4)), m1 = 0xFF << (2 * (3 - (x + w - 1) % 4));
+
+    for (int16_t r = y; r < y + h; r++) {
+        const byte *s = mask + (r - y0) * stride;
+        byte *row = rowStart(r);
+        for (int i = b0; i <= b1; i += 4) {
+            byte mk[4] = {0, 0, 0, 0};
+            int n = (b1 - i + 1 < 4) ? b1 - i + 1 : 4;
+            for (int j = 0; j < n; j++) {
+                int p = (i + j) * 4 - x0;               // stencil bit of the first pixel
+                int k = p >> 3;                         // may start one byte early
+                uint16_t bits = ((k >= 0) ? s[k] << 8 : 0) | ((k + 1 < stride) ? s[k + 1] : 0);
+                mk[j] = spread[(bits >> (12 - (p & 7))) & 0x0F];
+            }
+            if (i == b0) mk[0] &= m0;
+            if (i + n - 1 == b1) mk[n - 1] &= m1;
+
+            uint32_t v = 0, m;
+            memcpy(&m, mk, 4);
+            if (!m) continue;
+            memcpy(&v, row + i, n);
+            v = (v & ~m) | (fill & m);
+            memcpy(row + i, &v, n);
+        }
+    }
+}
+
+// Adds the number of pixels per grey level within the rectangle to COUNTS[0..3]
+void PL_smallEPD::countLevels(int16_t x, int16_t y, int16_t w, int16_t h, long counts[4]) {
+    countOp op = {counts};
+    if (!clipRect(x, y, w, h)) return;
+    for (int16_t r = y; r < y + h; r++) rasterRow(rowStart(r), x, w, op);
+}
+
 // ************************************************************************************
 // UPDATE - Triggers an image update based on the content written in the image buffer.
 // There are three different updateModes supported: EPD_UPD_FULL(0) is set by default,
@@ -209,36 +417,152 @@ void PL_smallEPD::invert(bool b2) {
 // NOT FASTER THAN MINUTELY (OR RUN BACK2BACK UPDATES NOT LONGER AS ONE HOUR PER DAY.)
 // ************************************************************************************
 void PL_smallEPD::update(int updateMode, byte coovl, bool manPow) {
+    uint32_t hash = hashBytes(buffer, _buffersize);
+    if (skipRestored(hash, updateMode))
+        return;
+    selectProfile();
+    if (updateMode == EPD_UPD_MONO && !getProfile().allowMono)
+        updateMode = EPD_UPD_PART;
     updateLectum(updateMode, manPow);
+    _frameHash = hash;
+    _updateCount++;
+    clearDirtyRect();
+    saveSnapshot(true);
+}
+
+// ************************************************************************************
+// SKIPRESTORED - Called with the HASH of the new frame by the first update after a
+// restored boot (see setFrameStore()): returns TRUE if the same content is on the
+// glass already, and switches UPDATEMODE to EPD_UPD_FULL if the UC8156 did not get
+// the previous image back.
+// ************************************************************************************
+bool PL_smallEPD::skipRestored(uint32_t hash, int &updateMode) {
+    if (!_restored)
+        return false;
+    byte restored = _restored;
+    _restored = 0;
+    if (hash == _storedHash) {
+        clearDirtyRect();                       //Shown already, as if updated
+        return true;
+    }
+    if (restored == 1)
+        updateMode = EPD_UPD_FULL;
+    return false;
 }
 
 void PL_smallEPD::updateLectum(int updateMode, bool manPow) {
+    while (poll()) {}                           // Let a running present() finish first
     scrambleBuffer();
+    startUpdate(updateMode, manPow);
+    waitForBusyInactive();
+    TRACE(EPD_TRACE_DRIVE, EPD_DISPLAYENGINE, _traceDrive, 0);
+    if (!manPow) 
+        powerOff();
+}
+
+// ************************************************************************************
+// PRESENT - Non-blocking variant of update(). The buffer is scrambled into buffer2 and
+// sent to the UC8156, the waveform is started and the function returns immediately,
+// so the next frame can be drawn into the buffer while the panel is still driving.
+// Frames presented while the panel is busy are kept in buffer2 and replace each
+// other (latest wins, see getDroppedFrames()); the last one is started by poll() as
+// soon as the running waveform has finished. buffer2 must not be touched meanwhile.
+// ************************************************************************************
+void PL_smallEPD::present(int updateMode) {
+    poll();
+    uint32_t hash = hashBytes(buffer, _buffersize);
+    if (skipRestored(hash, updateMode))
+        return;
+    selectProfile();
+    if (updateMode == EPD_UPD_MONO && !getProfile().allowMono)
+        updateMode = EPD_UPD_PART;
+    scrambleBuffer();
+    if (_driving) {                             // Panel busy: park the frame in buffer2
+        if (_pending)
+            _droppedFrames++;
+        _pending = true;
+        _pendingMode = updateMode;
+        _pendingTime = millis();
+        _pendingHash = hash;
+        return;
+    }
+    _presentTime = millis();
+    _presentHash = hash;
+    startUpdate(updateMode, false);
+    _driving = true;
+}
+
+// ************************************************************************************
+// POLL - Has to be called regularly after present(), e.g. from loop(). Finishes a
+// completed waveform and starts the parked frame, if any. Returns TRUE as long as the
+// panel is still busy, so "while (epd.poll()) {}" waits until everything is visible.
+// ************************************************************************************
+bool PL_smallEPD::poll() {
+    if (_driving && digitalRead(busy) != LOW) {
+        TRACE(EPD_TRACE_DRIVE, EPD_DISPLAYENGINE, _traceDrive, 0);
+        powerOff();
+        _presentLatency = millis() - _presentTime;
+        _driving = false;
+        _frameHash = _presentHash;
+        _updateCount++;
+        if (_pending) {                         // buffer2 holds the next frame already,
+            _pending = false;                   // it is stored once that one is shown
+            _presentTime = _pendingTime;
+            _presentHash = _pendingHash;
+            startUpdate(_pendingMode, false);
+            _driving = true;
+        } else
+            saveSnapshot(true);
+    }
+    return _driving;
+}
+
+// ************************************************************************************
+// GETPRESENTLATENCY - Milliseconds from present() until the frame was visible, measured
+// for the last completed frame. GETDROPPEDFRAMES - Number of presented frames which got
+// replaced by a newer one before they were shown.
+// ************************************************************************************
+unsigned long PL_smallEPD::getPresentLatency() {
+    return _presentLatency;
+}
+
+unsigned int PL_smallEPD::getDroppedFrames() {
+    return _droppedFrames;
+}
+
+// ************************************************************************************
+// STARTUPDATE - Uploads buffer2 and triggers the waveform without waiting for it
+// ************************************************************************************
+void PL_smallEPD::startUpdate(int updateMode, bool manPow) {
     writeBuffer();
     if (!manPow) 
         powerOn();
     switch (updateMode) {
         case 0:
-            writeRegister(EPD_PROGRAMMTP, 0x00, -1, -1, -1);
-            writeRegister(EPD_DISPLAYENGINE, 0x03, -1, -1, -1);
-            waitForBusyInactive();
-            break;
         case 1:
             writeRegister(EPD_PROGRAMMTP, 0x00, -1, -1, -1);
-            writeRegister(EPD_DISPLAYENGINE, 0x03, -1, -1, -1);
-            waitForBusyInactive();
             break;
         case 2:
             writeRegister(EPD_PROGRAMMTP, 0x02, -1, -1, -1);
-            writeRegister(EPD_DISPLAYENGINE, 0x03, -1, -1, -1);
-            waitForBusyInactive();
+            break;
+        default:
+            return;
     }
-    if (!manPow) 
-        powerOff();
+    TRACE_START(t0);
+    digitalWrite(cs, LOW);                      // EPD_DISPLAYENGINE, busy is not awaited
+    SPI.transfer(EPD_DISPLAYENGINE);
+    SPI.transfer(0x03);
+    digitalWrite(cs, HIGH);
+#if EPD_TRACE > 0
+    _traceBusy = 0;
+    _traceDrive = t0;
+#endif
+    TRACE(EPD_TRACE_WRITE, EPD_DISPLAYENGINE, t0, 1, 0x03);
 }
 
 // ************************************************************************************
-// SCRAMBLEBUFFER - 
+// SCRAMBLEBUFFER - Converts the buffer into the source/gate order of the display in
+// buffer2, which is what writeBuffer() uploads; it keeps the image last sent.
 // ************************************************************************************
 void PL_smallEPD::scrambleBuffer() {
     switch (_EPDsize) {
@@ -260,6 +584,9 @@ void PL_smallEPD::scrambleBuffer() {
                         drawPixel2(_width/2+x/2, y, getPixel(x,y));
                 }
             }
+            break;
+        default:                                          // same order as the buffer
+            memcpy(buffer2, buffer, _buffersize);
     }
 }
 
@@ -273,16 +600,16 @@ void PL_smallEPD::setRotation(uint8_t o) {
         nextline = _height/4;             //Landscape mode (default)
         switch (_EPDsize) {
             case 11:
-                writeRegister(EPD_DATENTRYMODE, 0x07, -1, -1, -1); 
+                setEntryMode(0x07);
                 break;
             case 14:
-                writeRegister(EPD_DATENTRYMODE, 0x02, -1, -1, -1); 
+                setEntryMode(0x02);
                 break;
             case 21:
-                writeRegister(EPD_DATENTRYMODE, 0x20, -1, -1, -1);  
+                setEntryMode(0x20);
                 break;
             case 31:
-                writeRegister(EPD_DATENTRYMODE, 0x07, -1, -1, -1);  
+                setEntryMode(0x07);
         }
         
         _width  = _width + _height;
@@ -291,7 +618,7 @@ void PL_smallEPD::setRotation(uint8_t o) {
     }
     if (o==2) {
         nextline = _width/4;     //Portrait mode
-        writeRegister(EPD_DATENTRYMODE, 0x02, -1, -1, -1);
+        setEntryMode(0x02);
         _width  = _width;
         _height = _height;
   }
@@ -311,6 +638,7 @@ void PL_smallEPD::setVBorderColor(int color) {
 
 
 void PL_smallEPD::writeToPreviousBuffer(){
+    while (poll()) {}                           // Not while a present() frame is driving
     writeBuffer(true);
 }
 
@@ -326,14 +654,66 @@ void PL_smallEPD::writeToPreviousBuffer(){
 // ************************************************************************************
 uint8_t PL_smallEPD::readTemperature() {
     uint8_t temp;
+    TRACE_START(t0);
     digitalWrite(cs, LOW);
     SPI.transfer(EPD_REGREAD | 0x08);
     temp = SPI.transfer(0xFF);
     digitalWrite(cs, HIGH);
     waitForBusyInactive();
+    TRACE(EPD_TRACE_READ, 0x08, t0, 1, temp);
     return temp;
 }
 
+// ************************************************************************************
+// GETTEMPERATURE - Cached variant of readTemperature() in °C: the sensor is only read
+// again once the interval set by SETTEMPERATUREINTERVAL (default 60s) has passed.
+// While the panel is driving the last reading is kept, before the first one 20°C.
+// ************************************************************************************
+int8_t PL_smallEPD::getTemperature() {
+    if (!_driving && (!_tempValid || millis() - _tempTime >= _tempInterval)) {
+        _temperature = (int8_t)readTemperature();
+        _tempTime = millis();
+        _tempValid = true;
+    }
+    return _temperature;
+}
+
+void PL_smallEPD::setTemperatureInterval(unsigned long ms) {
+    _tempInterval = ms;
+    _tempValid = false;
+}
+
+// ************************************************************************************
+// UPDATEPROFILES - Before each update the profile of the current temperature band is
+// selected from TABLE (COUNT entries sorted by minTemp, the table is not copied).
+// It decides whether mono updates are allowed and scales the Legio color passes:
+// pass counts, voltages and the delays in between. GETPROFILE / GETPROFILEINDEX tell
+// which profile was used by the last update. By default a single profile keeps the
+// original constants, example/08_Profiles shows a table for cold and hot conditions.
+// ************************************************************************************
+void PL_smallEPD::setUpdateProfiles(const EPD_updateProfile *table, byte count) {
+    if (count == 0) return;
+    _profiles = table;
+    _profileCount = count;
+    _profile = 0;
+}
+
+byte PL_smallEPD::getProfileIndex() {
+    return _profile;
+}
+
+const EPD_updateProfile &PL_smallEPD::getProfile() {
+    return _profiles[_profile];
+}
+
+void PL_smallEPD::selectProfile() {
+    int8_t t = getTemperature();
+    _profile = 0;
+    for (byte i=1; i<_profileCount; i++)
+        if (t >= _profiles[i].minTemp)
+            _profile = i;
+}
+
 // PRIVATE
 
 // ************************************************************************************
@@ -384,17 +764,19 @@ void PL_smallEPD::writeBuffer(bool previous){
     else
         writeRegister(EPD_DATENTRYMODE, 0x20, -1, -1, -1);        
 
-    
+    TRACE_START(t0);
     digitalWrite(cs, LOW);
     SPI.transfer(0x10);
-    if (_EPDsize==31 or _EPDsize==21)
-        for (int i=0; i < _buffersize; i++) 
-            SPI.transfer(buffer2[i]);
-    else
-        for (int i=0; i < _buffersize; i++) 
-            SPI.transfer(buffer[i]);
+    for (int i=0; i < _buffersize; i++) 
+        SPI.transfer(buffer2[i]);
     digitalWrite(cs, HIGH);
     waitForBusyInactive();
+#if EPD_TRACE > 0
+    uint16_t sum = 0;
+    for (int i=0; i < _buffersize; i++)
+        sum = (sum << 1 | sum >> 15) ^ buffer2[i];
+    trace(EPD_TRACE_BUFFER, 0x10, t0, _buffersize, lowByte(sum), highByte(sum), previous);
+#endif
 }
 
 
@@ -403,6 +785,7 @@ void PL_smallEPD::writeBuffer(bool previous){
 // ************************************************************************************
 void PL_smallEPD::writeRegister(uint8_t address, int16_t val1, int16_t val2, 
     int16_t val3, int16_t val4) {
+    TRACE_START(t0);
     digitalWrite(cs, LOW);
     SPI.transfer(address);
     if (val1!=-1) SPI.transfer((byte)val1);
@@ -411,6 +794,8 @@ void PL_smallEPD::writeRegister(uint8_t address, int16_t val1, int16_t val2,
     if (val4!=-1) SPI.transfer((byte)val4);
     digitalWrite(cs, HIGH);
     waitForBusyInactive();
+    TRACE(EPD_TRACE_WRITE, address, t0, (val1!=-1) + (val2!=-1) + (val3!=-1) + (val4!=-1),
+        val1, val2, val3, val4);
 }
 
 // ************************************************************************************
@@ -418,11 +803,13 @@ void PL_smallEPD::writeRegister(uint8_t address, int16_t val1, int16_t val2,
 // ************************************************************************************
 byte PL_smallEPD::readRegister(char address){
     byte data;
+    TRACE_START(t0);
     digitalWrite(cs, LOW);                                      
     SPI.transfer(address | EPD_REGREAD);
     data = SPI.transfer(0xFF);                         
     digitalWrite(cs, HIGH);
     waitForBusyInactive();
+    TRACE(EPD_TRACE_READ, address, t0, 1, data);
     return data;                                        // can be improved
 }
 
@@ -431,6 +818,401 @@ void PL_smallEPD::loadImg(const unsigned char *pic_name) {
           buffer[j] = pgm_read_byte_near(pic_name + j);
       }
 }
+
+// ************************************************************************************
+// BUNDLE - Access to image bundles in flash (format see PL_smallBundle.h). Images are
+// addressed by their ID, which indexes the table directly, FINDBUNDLEIMAGE translates a
+// name into the ID. LOADBUNDLEPLANE decodes one color plane (0 = BW .. 4 = blue) of an
+// image into the buffer and returns FALSE if the image has no such plane. Blobs not
+// starting with EPD_BUNDLE_MAGIC are treated as empty bundles.
+// ************************************************************************************
+static uint16_t pgmWord(const unsigned char *p) {
+    return pgm_read_byte_near(p) | (uint16_t)pgm_read_byte_near(p + 1) << 8;
+}
+
+struct pgmSource {
+    const unsigned char *p;
+    uint16_t left;
+};
+
+static int readPgm(void *ctx) {
+    pgmSource *s = (pgmSource *)ctx;
+    if (s->left == 0) return -1;
+    s->left--;
+    return pgm_read_byte_near(s->p++);
+}
+
+static uint16_t bundleImages(const unsigned char *bundle) {
+    for (int i = 0; i < 4; i++)
+        if (pgm_read_byte_near(bundle + i) != (byte)EPD_BUNDLE_MAGIC[i]) return 0;
+    return pgmWord(bundle + 4);
+}
+
+bool PL_smallEPD::isBundleImage(const unsigned char *bundle, uint16_t id) {
+    return id < bundleImages(bundle);
+}
+
+byte PL_smallEPD::getBundleFlags(const unsigned char *bundle, uint16_t id) {
+    if (id >= bundleImages(bundle)) return 0;
+    return pgm_read_byte_near(bundle + EPD_BUNDLE_HEADER + id * EPD_BUNDLE_ENTRY + EPD_BUNDLE_NAMELEN);
+}
+
+int PL_smallEPD::findBundleImage(const unsigned char *bundle, const char *name) {
+    uint16_t n = bundleImages(bundle);
+    for (uint16_t id = 0; id < n; id++) {
+        const unsigned char *e = bundle + EPD_BUNDLE_HEADER + id * EPD_BUNDLE_ENTRY;
+        int i = 0;
+        while (i < EPD_BUNDLE_NAMELEN && name[i] && pgm_read_byte_near(e + i) == (byte)name[i]) i++;
+        if ((i == EPD_BUNDLE_NAMELEN) || ((name[i] == 0) && (pgm_read_byte_near(e + i) == 0)))
+            return id;
+    }
+    return -1;
+}
+
+bool PL_smallEPD::loadBundlePlane(const unsigned char *bundle, uint16_t id, byte plane) {
+    if ((plane >= EPD_BUNDLE_PLANES) || !(getBundleFlags(bundle, id) & (0x80 >> plane)))
+        return false;
+
+    const unsigned char *e = bundle + EPD_BUNDLE_HEADER + id * EPD_BUNDLE_ENTRY;
+    uint16_t record = pgmWord(e + EPD_BUNDLE_NAMELEN + 2 + plane * 2);
+    if (record == EPD_BUNDLE_NOPLANE)
+        return false;
+
+    const unsigned char *r = bundle + EPD_BUNDLE_HEADER + pgmWord(bundle + 4) * EPD_BUNDLE_ENTRY
+        + record * EPD_BUNDLE_RECORD;
+    pgmSource src;
+    src.p = bundle + (pgmWord(r) | (uint32_t)pgmWord(r + 2) << 16);
+    src.left = pgmWord(r + 4);
+
+    int n;
+    if (pgm_read_byte_near(r + 6) == EPD_BUNDLE_RLE) {
+        PL_smallRLE rle;
+        rle.begin(readPgm, &src);
+        n = rle.read(buffer, sizeof(buffer));
+    } else
+        for (n = 0; n < (int)sizeof(buffer) && src.left > 0; n++)
+            buffer[n] = readPgm(&src);
+    for (; n < (int)sizeof(buffer); n++)
+        buffer[n] = 0xFF;
+    return true;
+}
+
+// ************************************************************************************
+// APPLYPATCHES - Reads a delta patch stream (format see PL_smallPatch.h) from S, e.g.
+// Serial or a BLE UART, and writes the rectangles straight into the buffer. The area
+// touched is added to the dirty rectangle (getDirtyRect(), reset by update()). Returns
+// the update mode hint of the stream, EPD_PATCH_NONE if there was none or
+// EPD_PATCH_ERROR on a timeout (Stream::setTimeout()) or a malformed record.
+// ************************************************************************************
+static int readStream(void *ctx) {
+    byte b;
+    return ((Stream *)ctx)->readBytes(&b, 1) == 1 ? b : -1;
+}
+
+int PL_smallEPD::applyPatches(Stream &s) {
+    byte row[EPD_HEIGHT / 4];                   // longest possible row
+
+    for (;;) {
+        int op = readStream(&s);
+        if (op == EPD_PATCH_END) return EPD_PATCH_NONE;
+        if (op == EPD_PATCH_UPDATE) {
+            int mode = readStream(&s);
+            return mode < 0 ? EPD_PATCH_ERROR : mode;
+        }
+        if (op != EPD_PATCH_RECT) return EPD_PATCH_ERROR;
+
+        byte h[9];
+        if (s.readBytes(h, sizeof(h)) != sizeof(h)) return EPD_PATCH_ERROR;
+        int16_t px = h[0] | h[1] << 8, py = h[2] | h[3] << 8;
+        int16_t pw = h[4] | h[5] << 8, ph = h[6] | h[7] << 8;
+        if ((pw <= 0) || (pw > EPD_HEIGHT) || (ph < 0)) return EPD_PATCH_ERROR;
+
+        PL_smallRLE rle;
+        rle.begin(readStream, &s);
+        int n = (pw + 3) / 4;
+        for (int16_t r = 0; r < ph; r++) {
+            if (rle.read(row, n) != n) return EPD_PATCH_ERROR;
+            writePatchRow(px, py + r, pw, row, h[8]);
+        }
+
+        int16_t x1 = px + pw - 1, y1 = py + ph - 1;     // clipped to the screen
+        if (px < 0) px = 0;
+        if (py < 0) py = 0;
+        if (x1 >= _width) x1 = _width - 1;
+        if (y1 >= _height) y1 = _height - 1;
+        if ((x1 < px) || (y1 < py)) continue;
+        if (px < _dirtyX0) _dirtyX0 = px;
+        if (py < _dirtyY0) _dirtyY0 = py;
+        if (x1 > _dirtyX1) _dirtyX1 = x1;
+        if (y1 > _dirtyY1) _dirtyY1 = y1;
+    }
+}
+
+bool PL_smallEPD::getDirtyRect(int16_t &x, int16_t &y, int16_t &w, int16_t &h) {
+    if (_dirtyX1 < 0) return false;
+    x = _dirtyX0;
+    y = _dirtyY0;
+    w = _dirtyX1 - _dirtyX0 + 1;
+    h = _dirtyY1 - _dirtyY0 + 1;
+    return true;
+}
+
+void PL_smallEPD::clearDirtyRect() {
+    _dirtyX0 = _dirtyY0 = EPD_WIDTH + EPD_HEIGHT;
+    _dirtyX1 = _dirtyY1 = -1;
+}
+
+// ************************************************************************************
+// WRITEPATCHROW - Copies W packed pixels to X, Y of the buffer. Rows starting on a byte
+// boundary are copied bytewise, others pixel by pixel. PLANE is ignored here, the Legio
+// class maps planes into its canvas.
+// ************************************************************************************
+void PL_smallEPD::writePatchRow(int16_t x, int16_t y, int16_t w, const byte *row, byte) {
+    if ((y < 0) || (y >= _height)) return;
+
+    if ((x >= 0) && (x % 4 == 0) && (x + w <= _width)) {
+        if (_EPDsize==11 || _EPDsize==3)                // same offset as drawPixel()
+            y=y+3;
+        byte *dst = &buffer[x / 4 + y * nextline];
+        int n = w / 4;
+        memcpy(dst, row, n);
+        if (w % 4) {
+            byte mask = 0xFF >> (2 * (w % 4));          // pixels behind the row stay
+            dst[n] = (dst[n] & mask) | (row[n] & ~mask);
+        }
+        return;
+    }
+    for (int16_t i = 0; i < w; i++)
+        drawPixel(x + i, y, (row[i / 4] >> (6 - 2 * (i % 4))) & 0x03);
+}
+
+// ************************************************************************************
+// DRAWGRAY - Dithers an 8 bit greyscale image (0 = black, 255 = white) of W x H pixels
+// down to the four grey levels and writes it packed straight into the image buffer at
+// position X, Y. The rows are fetched one by one via GETROW (return FALSE to abort),
+// so the image never has to be in memory as a whole; GETROW receives W bytes (W <=
+// EPD_DITHER_MAXWIDTH). MODE is EPD_DITHER_FS or EPD_DITHER_ORDERED. The second
+// variant reads the rows from a Stream, e.g. Serial, and stops on a timeout. The image
+// is clipped to the screen; rows and columns outside are still dithered, so the error
+// diffusion of the visible part is the same as for the whole image.
+// ************************************************************************************
+void PL_smallEPD::drawGray(int16_t x, int16_t y, int16_t w, int16_t h, EPD_rowReader getRow,
+    void *ctx, uint8_t mode) {
+    uint8_t row[EPD_DITHER_MAXWIDTH], packed[EPD_DITHER_MAXWIDTH / 4];
+    PL_smallDither dither;
+
+    if ((w <= 0) || (w > EPD_DITHER_MAXWIDTH)) return;
+    int16_t cx = x, cy = y, cw = w, ch = h;                 // visible part
+    bool visible = clipRect(cx, cy, cw, ch);
+
+    dither.begin(mode, w);
+    for (int16_t r = 0; r < h; r++) {
+        if (!getRow(r, row, ctx)) return;
+        dither.grayRow(row, packed);            // off-screen rows still feed the error
+        if (!visible || (y + r < cy) || (y + r >= cy + ch)) continue;
+
+        byte *dst = rowStart(y + r);
+        for (int16_t i = cx - x; i < cx - x + cw; i++) {
+            byte q = (packed[i >> 2] >> (6 - 2 * (i & 3))) & 0x03;
+            int px = x + i, shift = 6 - 2 * (px & 3);
+            dst[px >> 2] = (dst[px >> 2] & ~(0x03 << shift)) | (q << shift);
+        }
+    }
+}
+
+struct streamRows {
+    Stream *s;
+    int16_t w;
+};
+
+static bool readStreamRow(int16_t, uint8_t *dst, void *ctx) {
+    streamRows *sr = (streamRows *)ctx;
+    return sr->s->readBytes(dst, sr->w) == (size_t)sr->w;  // FALSE on a Stream timeout
+}
+
+void PL_smallEPD::drawGray(int16_t x, int16_t y, int16_t w, int16_t h, Stream &s, uint8_t mode) {
+    streamRows sr;
+    sr.s = &s;
+    sr.w = w;
+    drawGray(x, y, w, h, readStreamRow, &sr, mode);
+}
+
+// ************************************************************************************
+// RESET - Hardware reset via the RST pin, or a software reset if no pin is defined
+// ************************************************************************************
+void PL_smallEPD::reset() {
+    if (rst!=-1) {
+        digitalWrite(rst, HIGH);                //Trigger a global hardware reset...
+        delay(5);   
+        digitalWrite(rst, LOW);
+        delay(5);        
+        digitalWrite(rst, HIGH);
+        delay(5);        
+        waitForBusyInactive();
+    } else
+        writeRegister(EPD_SOFTWARERESET, -1, -1, -1, -1);    //... or do software reset if no pin defined
+}
+
+void PL_smallEPD::setEntryMode(byte mode) {
+    _entryMode = mode;
+    writeRegister(EPD_DATENTRYMODE, mode, -1, -1, -1);
+}
+
+// ************************************************************************************
+// CONFIGURE - Writes the register set depending on the display size found by begin()
+// plus the general settings and the data entry mode of the current rotation.
+// ************************************************************************************
+void PL_smallEPD::configure() {
+    switch (_EPDsize) {
+        case 21:
+            writeRegister(EPD_PANELSETTING, 0x10, -1, -1, -1);        
+            writeRegister(EPD_WRITEPXRECTSET, 0, 239, 0, 145);  //147?
+            //writeRegister(EPD_VCOMCONFIG, 0x00, 0x00, 0x24, 0x07);
+            writeRegister(EPD_VCOMCONFIG, 0x00, 0x00, 0x24, 0x05);
+            break;
+    }
+   // writeRegister(0x1B, 0xA7, 0x04, -1, -1);
+    writeRegister(EPD_DRIVERVOLTAGE, 0x25, 0xff, -1, -1);
+    writeRegister(EPD_BORDERSETTING, 0x04, -1, -1, -1);
+    writeRegister(EPD_LOADMONOWF, 0x60, -1, -1, -1);
+    writeRegister(EPD_INTTEMPERATURE, 0x0A, -1, -1, -1);
+    writeRegister(EPD_BOOSTSETTING, 0x22, 0x17, -1, -1);
+    if (_entryMode!=-1)
+        writeRegister(EPD_DATENTRYMODE, _entryMode, -1, -1, -1);
+}
+
+// ************************************************************************************
+// SNAPSHOT - Header layout (little endian): uint32 magic, uint8 EPD size, uint8 planes,
+// uint16 reserved, uint32 update count, uint32 hash, uint16 image length (0 = hash
+// only), uint16 reserved, followed by the image (PL_smallRLE coded buffer2). The header
+// is invalidated first and written last, so an interrupted write never leaves a valid
+// header pointing to a half written image. The hash is taken from _frameHash, which
+// the caller sets to the frame just shown. IMAGE = FALSE stores the hash only (Legio).
+// ************************************************************************************
+struct storeSink {
+    EPD_storeWrite write;
+    void *ctx;
+    uint32_t addr;
+    byte buf[32];
+    byte n;
+    bool ok;
+};
+
+static void writeStoreByte(uint8_t b, void *ctx) {
+    storeSink *s = (storeSink *)ctx;
+    s->buf[s->n++] = b;
+    if (s->n == sizeof(s->buf)) {
+        s->ok = s->ok && s->write(s->addr, s->buf, s->n, s->ctx);
+        s->addr += s->n;
+        s->n = 0;
+    }
+}
+
+struct storeSource {
+    EPD_storeRead read;
+    void *ctx;
+    uint32_t addr;
+    uint16_t left;
+    byte buf[32];
+    byte n, pos;
+};
+
+static int readStoreByte(void *ctx) {
+    storeSource *s = (storeSource *)ctx;
+    if (s->pos == s->n) {
+        if (s->left == 0) return -1;
+        s->n = s->left < sizeof(s->buf) ? s->left : sizeof(s->buf);
+        if (!s->read(s->addr, s->buf, s->n, s->ctx)) return -1;
+        s->addr += s->n;
+        s->left -= s->n;
+        s->pos = 0;
+    }
+    return s->buf[s->pos++];
+}
+
+static void put32(byte *p, uint32_t v) {
+    for (int i=0; i<4; i++) p[i] = v >> (8 * i);
+}
+
+static uint32_t get32(const byte *p) {
+    return p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+uint32_t PL_smallEPD::hashBytes(const byte *p, int n, uint32_t h) {
+    for (int i=0; i<n; i++)
+        h = (h ^ p[i]) * 16777619UL;            // FNV-1a
+    return h;
+}
+
+void PL_smallEPD::saveSnapshot(bool image) {
+    if (!_storeWrite || _hold) return;
+    uint32_t hash = _frameHash;
+    if (_stored && hash == _storedHash) return;
+
+    byte h[EPD_SNAPSHOT_HEADER];
+    uint16_t len = 0;
+    memset(h, 0, sizeof(h));
+    if (!_storeWrite(0, h, 4, _storeCtx)) return;
+    if (image) {
+        long size = PL_smallRLE::encode(buffer2, _buffersize);
+        if (EPD_SNAPSHOT_HEADER + size <= (long)_storeSize) {
+            storeSink sink;
+            sink.write = _storeWrite;
+            sink.ctx   = _storeCtx;
+            sink.addr  = EPD_SNAPSHOT_HEADER;
+            sink.n     = 0;
+            sink.ok    = true;
+            PL_smallRLE::encode(buffer2, _buffersize, writeStoreByte, &sink);
+            if (sink.n > 0)
+                sink.ok = sink.ok && _storeWrite(sink.addr, sink.buf, sink.n, _storeCtx);
+            if (sink.ok)
+                len = size;
+        }
+    }
+    put32(h, EPD_SNAPSHOT_MAGIC);
+    h[4] = _EPDsize;
+    h[5] = _planes;
+    put32(h + 8, _updateCount);
+    put32(h + 12, hash);
+    h[16] = lowByte(len);
+    h[17] = highByte(len);
+    if (_storeWrite(0, h, sizeof(h), _storeCtx)) {
+        _stored = true;
+        _storedHash = hash;
+    }
+}
+
+bool PL_smallEPD::restoreSnapshot() {
+    byte h[EPD_SNAPSHOT_HEADER];
+    if (!_storeRead || !_storeRead(0, h, sizeof(h), _storeCtx)) return false;
+    if (get32(h) != EPD_SNAPSHOT_MAGIC || h[4] != _EPDsize) return false;
+
+    _planes      = h[5];
+    _updateCount = get32(h + 8);
+    _storedHash  = get32(h + 12);
+    _frameHash   = _storedHash;
+    _stored      = true;
+    _wasRestored = true;
+    _restored    = 1;
+
+    storeSource src;
+    src.read = _storeRead;
+    src.ctx  = _storeCtx;
+    src.addr = EPD_SNAPSHOT_HEADER;
+    src.left = h[16] | h[17] << 8;
+    src.n    = 0;
+    src.pos  = 0;
+    if (src.left > 0) {
+        PL_smallRLE rle;
+        rle.begin(readStoreByte, &src);
+        if (rle.read(buffer2, _buffersize) == _buffersize) {
+            writeBuffer(true);                  //Back into the UC8156 as previous image
+            _restored = 2;
+        }
+    }
+    return true;
+}
+
 // ************************************************************************************
 // GETEPDSIZE - Returns the size of the attached display diagonal, e.g. 11 is 
 // equivalent to to a 1.1" EPD, 21 correpsonds to 2.1" and 31 is equal to 3.1" EPD size
@@ -468,13 +1250,78 @@ byte PL_smallEPD::getEPDsize(){
 // Function returns only after driver IC is free again for listening to new commands.
 // ************************************************************************************
 void PL_smallEPD::waitForBusyInactive(){
+    TRACE_START(t0);
     while (digitalRead(busy) == LOW) {}
+#if EPD_TRACE > 0
+    _traceBusy = micros() - t0;
+#endif
 }
 
 // ************************************************************************************
 // DEEPSLEEP - Putting the UC8156 in deep sleep mode with less than 1µA current @3.3V.
-// Reset pin toggling needed to wakeup the driver IC again.
+// Reset pin toggling needed to wakeup the driver IC again, wake() does this quickly.
 // ************************************************************************************
 void PL_smallEPD::deepSleep(void) {
     writeRegister(0x21, 0xff, 0xff, 0xff, 0xff); 
 }
+
+// ************************************************************************************
+// TRACE - Only active with EPD_TRACE > 0 (see PL_smallEPD.h). Every register access,
+// image upload and finished waveform is logged into a ring buffer of the last EPD_TRACE
+// records, allocated on the first one. DUMPTRACE prints them oldest first as CSV lines,
+// ready to be fed into extras/traceReplay:
+//   EPDT,time,type,reg,val1,val2,val3,val4,bytes,busy (-1 = unused)
+// ************************************************************************************
+#define EPD_TRACE_RING  (EPD_TRACE > 0 ? EPD_TRACE : 1)
+
+void PL_smallEPD::trace(uint8_t type, uint8_t reg, uint32_t t0, uint16_t bytes, int16_t v1,
+    int16_t v2, int16_t v3, int16_t v4) {
+    if (!_trace)
+        _trace = (EPD_traceRecord *)malloc(EPD_TRACE_RING * sizeof(EPD_traceRecord));
+    if (!_trace) return;
+    EPD_traceRecord &r = _trace[_traceHead];
+    int16_t v[4] = { v1, v2, v3, v4 };
+    r.time  = t0;
+    r.busy  = (type == EPD_TRACE_DRIVE) ? micros() - t0 : _traceBusy;
+    r.bytes = bytes;
+    r.type  = type;
+    r.reg   = reg;
+    r.n     = 0;
+    for (int i=0; i<4; i++)
+        if (v[i]!=-1) r.val[r.n++] = (uint8_t)v[i];
+    _traceHead = (_traceHead + 1) % EPD_TRACE_RING;
+    _traceCount++;
+}
+
+void PL_smallEPD::dumpTrace(Print &out) {
+    uint16_t n = !_trace ? 0 : _traceCount < EPD_TRACE_RING ? _traceCount : EPD_TRACE_RING;
+    uint16_t i = (_traceHead + EPD_TRACE_RING - n) % EPD_TRACE_RING;
+
+    out.print("EPDTRACE,");
+    out.print((unsigned long)_traceCount);
+    out.print(",");
+    out.println((unsigned long)(_traceCount - n));   // records lost by wrap-around
+    for (; n > 0; n--, i = (i + 1) % EPD_TRACE_RING) {
+        EPD_traceRecord &r = _trace[i];
+        out.print("EPDT,");
+        out.print((unsigned long)r.time);
+        out.print(",");
+        out.print((char)r.type);
+        out.print(",");
+        out.print(r.reg);
+        for (int k=0; k<4; k++) {
+            out.print(",");
+            if (k < r.n) out.print(r.val[k]);
+            else out.print("-1");
+        }
+        out.print(",");
+        out.print(r.bytes);
+        out.print(",");
+        out.println((unsigned long)r.busy);
+    }
+}
+
+void PL_smallEPD::clearTrace() {
+    _traceHead = 0;
+    _traceCount = 0;
+}
@@ -15,6 +15,10 @@ and open source hardware by purchasing this product @Plasticlogic
 #include <Adafruit_GFX.h>         
 #include <Adafruit_I2CDevice.h>
 #include <SPI.h>
+#include "PL_smallDither.h"
+#include "PL_smallRLE.h"
+#include "PL_smallBundle.h"
+#include "PL_smallPatch.h"
 
 #define EPD_WIDTH   (146)
 #define EPD_HEIGHT  (240)
@@ -25,10 +29,45 @@ and open source hardware by purchasing this product @Plasticlogic
 #define EPD_WHITE 0x03
 #define EPD_COOVL 0xFF
 
+// Records of SPI traffic kept for dumpTrace(), 0 = off. Set it here or as a global build
+// flag (-DEPD_TRACE=128): the library is compiled separately, a #define in the sketch
+// does not reach it. The class layout is the same either way.
+#ifndef EPD_TRACE
+#define EPD_TRACE   0
+#endif
+
 #define EPD_UPD_FULL  0x00            // Triggers a Full update, 4 GL, 800ms
 #define EPD_UPD_PART  0x01            // Triggers a Partial update, 4 GL, 800ms
 #define EPD_UPD_MONO  0x02            // Triggers a Partial Mono update, 2 GL, 250ms
 
+#define EPD_TRACE_WRITE   'W'       // Register write, VAL = parameters
+#define EPD_TRACE_READ    'R'       // Register read, VAL[0] = result
+#define EPD_TRACE_BUFFER  'B'       // Image upload, VAL[0..1] = checksum, VAL[2] = previous buffer
+#define EPD_TRACE_DRIVE   'E'       // Waveform finished, BUSY = time since it was started
+
+struct EPD_traceRecord {
+    uint32_t time;                  // micros() at start of the transfer
+    uint32_t busy;                  // micros() spent waiting for BUSY afterwards
+    uint16_t bytes;                 // bytes sent after the register address
+    uint8_t  type, reg, n;          // n = valid entries in val
+    uint8_t  val[4];
+};
+
+typedef bool (*EPD_rowReader)(int16_t row, uint8_t *dst, void *ctx);
+typedef bool (*EPD_storeRead)(uint32_t addr, uint8_t *dst, uint16_t n, void *ctx);
+typedef bool (*EPD_storeWrite)(uint32_t addr, const uint8_t *src, uint16_t n, void *ctx);
+
+struct EPD_updateProfile {
+    int8_t  minTemp;                // Profile applies from this temperature (°C) upwards
+    int8_t  passDelta;              // Added to the Legio pass counts, at least 1 remains
+    int16_t voltageDelta;           // mV added to the Legio TPCOM and source voltage (whole V)
+    uint8_t dwell;                  // Delay after each Legio pass, ms (red: 10x)
+    bool    allowMono;              // FALSE turns EPD_UPD_MONO into EPD_UPD_PART
+};
+
+#define EPD_SNAPSHOT_MAGIC    0x31534C50UL  // "PLS1"
+#define EPD_SNAPSHOT_HEADER   20            // magic, size, planes, -, count, hash, length, -
+
 #define EPD_REVISION          0x00  // Revision, Read only
 #define EPD_PANELSETTING      0x01
 #define EPD_DRIVERVOLTAGE     0x02
@@ -54,39 +93,110 @@ class PL_smallEPD : public Adafruit_GFX {
 
 public:
     PL_smallEPD(int8_t _cs, int8_t _rst=-1, int8_t _busy=-1);
+    ~PL_smallEPD();
     void begin(int8_t BGcolor=-1);
     void clear(byte c = EPD_WHITE, bool b2=false);
     virtual void clearScreen(int8_t BGcolor);
     void drawPixel(int16_t x, int16_t y, uint16_t color);
     void invert(bool b2=false);
+    void invertRect(int16_t x, int16_t y, int16_t w, int16_t h);
+    void remapRect(int16_t x, int16_t y, int16_t w, int16_t h, const byte lut[4]);
+    void thresholdRect(int16_t x, int16_t y, int16_t w, int16_t h, byte level=EPD_LGRAY);
+    void maskRect(int16_t x, int16_t y, int16_t w, int16_t h, const byte *mask, byte color);
+    void countLevels(int16_t x, int16_t y, int16_t w, int16_t h, long counts[4]);
     virtual void update(int updateMode=EPD_UPD_FULL, byte coovl=EPD_COOVL, bool manPow=false);
     void updateLectum(int updateMode=EPD_UPD_FULL, bool manPow=false);
+    void present(int updateMode=EPD_UPD_PART);
+    bool poll(void);
+    unsigned long getPresentLatency(void);
+    unsigned int getDroppedFrames(void);
     void setRotation(uint8_t o);
     void loadImg(const unsigned char *pic_name);
+    bool loadBundlePlane(const unsigned char *bundle, uint16_t id, byte plane=0);
+    bool isBundleImage(const unsigned char *bundle, uint16_t id);
+    byte getBundleFlags(const unsigned char *bundle, uint16_t id);
+    int findBundleImage(const unsigned char *bundle, const char *name);
+    void drawGray(int16_t x, int16_t y, int16_t w, int16_t h, EPD_rowReader getRow, void *ctx,
+        uint8_t mode=EPD_DITHER_FS);
+    void drawGray(int16_t x, int16_t y, int16_t w, int16_t h, Stream &s, uint8_t mode=EPD_DITHER_FS);
+    int applyPatches(Stream &s);
+    bool getDirtyRect(int16_t &x, int16_t &y, int16_t &w, int16_t &h);
+    void clearDirtyRect(void);
     void setVBorderColor(int color);
     void writeToPreviousBuffer();    
     uint8_t readTemperature(void);
+    int8_t getTemperature(void);
+    void setTemperatureInterval(unsigned long ms);
+    void setUpdateProfiles(const EPD_updateProfile *table, byte count);
+    byte getProfileIndex(void);
+    const EPD_updateProfile &getProfile(void);
     void deepSleep(void);
+    bool wake(bool restore=true);
+    void setFrameStore(EPD_storeRead read, EPD_storeWrite write, void *ctx, uint32_t size);
+    bool isRestored(void);
+    byte getRestoredPlanes(void);
+    uint32_t getUpdateCount(void);
     int width, height;
     byte buffer[EPD_WIDTH * EPD_HEIGHT / 4];
     byte buffer2[EPD_WIDTH * EPD_HEIGHT / 4];
     void powerOn(void);
     void powerOff(void);
     void writeRegister(uint8_t address, int16_t val1, int16_t val2, int16_t val3, int16_t val4);
+    void dumpTrace(Print &out=Serial);
+    void clearTrace(void);
 
+protected:
+    int nextline=EPD_WIDTH/4;
+    byte _planes=0;
+    bool _hold=false;
+    byte _restored=0;
+    uint32_t _frameHash=0, _updateCount=0;
+    void saveSnapshot(bool image);
+    bool skipRestored(uint32_t hash, int &updateMode);
+    void selectProfile(void);
+    static uint32_t hashBytes(const byte *p, int n, uint32_t h=2166136261UL);
+    virtual void writePatchRow(int16_t x, int16_t y, int16_t w, const byte *row, byte plane);
 
 private:
-    int _EPDsize, _buffersize;
+    int _EPDsize=0, _buffersize;
+    int _entryMode=-1;
+    EPD_storeRead _storeRead=0;
+    EPD_storeWrite _storeWrite=0;
+    void *_storeCtx;
+    uint32_t _storeSize, _storedHash;
+    bool _stored=false, _wasRestored=false;
+    bool restoreSnapshot(void);
+    const EPD_updateProfile *_profiles;
+    byte _profileCount, _profile=0;
+    int8_t _temperature=20;
+    unsigned long _tempTime, _tempInterval=60000;
+    bool _tempValid=false;
+    int16_t _dirtyX0=EPD_WIDTH+EPD_HEIGHT, _dirtyY0=EPD_WIDTH+EPD_HEIGHT, _dirtyX1=-1, _dirtyY1=-1;
     int cs, rst, busy;
     int cursorX, cursorY;
     int fontHeight=8, fontWidth=5;
-    int nextline=EPD_WIDTH/4;
+    bool _driving=false, _pending=false;
+    int _pendingMode;
+    unsigned long _presentTime, _pendingTime, _presentLatency=0;
+    uint32_t _presentHash, _pendingHash;
+    unsigned int _droppedFrames=0;
+    EPD_traceRecord *_trace=0;      // allocated by the first record if EPD_TRACE > 0
+    uint16_t _traceHead=0;
+    uint32_t _traceCount=0, _traceBusy=0, _traceDrive=0;
+    void trace(uint8_t type, uint8_t reg, uint32_t t0, uint16_t bytes, int16_t v1=-1, int16_t v2=-1,
+        int16_t v3=-1, int16_t v4=-1);
     byte getEPDsize(void);
+    void reset(void);
+    void configure(void);
+    void setEntryMode(byte mode);
+    bool clipRect(int16_t &x, int16_t &y, int16_t &w, int16_t &h);
+    byte *rowStart(int16_t y);
     void waitForBusyInactive(void);
     byte readRegister(char address);
     int getPixel(int x, int y);
     void drawPixel2(int x, int y, int color);
     void scrambleBuffer(void);
+    void startUpdate(int updateMode, bool manPow);
     void writeBuffer(bool previous=false);
   };
 
@@ -22,6 +22,8 @@ void PL_smallLegio::clearScreen(int8_t BGcolor)
 {
     if (BGcolor>=0)
 	{  
+        _restored = 0;                          // Glass content is known from now on
+        beginFrame();
         setSourceVoltage(15000);
         powerOn();
 
@@ -75,6 +77,9 @@ void PL_smallLegio::clearScreen(int8_t BGcolor)
 
         clear(EPD_WHITE);
         powerOff();
+
+        _planes = 0;                            // Screen is plain BGCOLOR now
+        endFrame(hashBytes(0, 0) ^ BGcolor);
     }
 }
 
@@ -85,34 +90,64 @@ void PL_smallLegio::loadImage(const unsigned char *pic_name, int BUFFER_COLOR_ST
 
 void PL_smallLegio::showImage(const unsigned char *pic_name)
 {
-    if ((byte)pic_name[3] & 0x80) {
-        loadImage(pic_name, BUFFER_BW_START);
-        updateLegio(EPD_BLACK);
-    }
+    static const byte flag[5]  = { 0x80, 0x40, 0x20, 0x10, 0x08 };
+    static const int start[5]  = { BUFFER_BW_START, BUFFER_YELLOW_START, BUFFER_GREEN_START,
+                                   BUFFER_RED_START, BUFFER_BLUE_START };
+    static const byte color[5] = { EPD_BLACK, EPD_YELLOW, EPD_GREEN, EPD_RED, EPD_BLUE };
+    uint32_t hash = hashBytes(0, 0);
 
-    if ((byte)pic_name[3] & 0x40)
-	{
-        loadImage(pic_name, BUFFER_YELLOW_START);
-        updateLegio(EPD_YELLOW);
+    if (_restored)                              // Hash ahead only if the frame may be skipped
+    {
+        for (int p = 0; p < 5; p++)
+            if ((byte)pic_name[3] & flag[p])
+            {
+                loadImage(pic_name, start[p]);
+                hash = hashBytes(buffer, sizeof(buffer), hash ^ color[p]);
+            }
+        if (skipFrame(hash)) return;
+        hash = hashBytes(0, 0);
     }
 
-    if ((byte)pic_name[3] & 0x20)
-	{
-        loadImage(pic_name, BUFFER_GREEN_START);
-        updateLegio(EPD_GREEN);
-    }
+    beginFrame();
+    for (int p = 0; p < 5; p++)
+        if ((byte)pic_name[3] & flag[p])
+        {
+            loadImage(pic_name, start[p]);
+            hash = hashBytes(buffer, sizeof(buffer), hash ^ color[p]);
+            updateLegio(color[p]);
+        }
+    endFrame(hash);
+}
 
-    if ((byte)pic_name[3] & 0x10)
-	{
-        loadImage(pic_name, BUFFER_RED_START);
-        updateLegio(EPD_RED);
-    }
+// ************************************************************************************
+// SHOWIMAGE (BUNDLE) - Shows image ID of a bundle built by extras/bundlePacker, only the
+// planes stored for it are loaded and driven. The ID is looked up in constant time.
+// Returns FALSE, without touching the screen, if BUNDLE is no bundle or has no image ID.
+// ************************************************************************************
+bool PL_smallLegio::showImage(const unsigned char *bundle, uint16_t id)
+{
+    static const byte color[EPD_BUNDLE_PLANES] = { EPD_BLACK, EPD_YELLOW, EPD_GREEN, EPD_RED, EPD_BLUE };
+    uint32_t hash = hashBytes(0, 0);
+
+    if (!isBundleImage(bundle, id)) return false;
 
-    if ((byte)pic_name[3] & 0x08)
-	{
-        loadImage(pic_name, BUFFER_BLUE_START);
-        updateLegio(EPD_BLUE);
+    if (_restored)                              // Hash ahead only if the frame may be skipped
+    {
+        for (byte p = 0; p < EPD_BUNDLE_PLANES; p++)
+            if (loadBundlePlane(bundle, id, p)) hash = hashBytes(buffer, sizeof(buffer), hash ^ color[p]);
+        if (skipFrame(hash)) return true;
+        hash = hashBytes(0, 0);
     }
+
+    beginFrame();
+    for (byte p = 0; p < EPD_BUNDLE_PLANES; p++)
+        if (loadBundlePlane(bundle, id, p))
+        {
+            hash = hashBytes(buffer, sizeof(buffer), hash ^ color[p]);
+            updateLegio(color[p]);
+        }
+    endFrame(hash);
+    return true;
 }
 
 void PL_smallLegio::setTPCOM(int v, bool VkbConsidered)
@@ -124,35 +159,99 @@ void PL_smallLegio::setTPCOM(int v, bool VkbConsidered)
 
 void PL_smallLegio::setSourceVoltage(int v)
 {
-    v = round(v / 1000);
+    v = (v + 500) / 1000;                      // mV to the nearest volt
+    if (v < 8) v = 8;
+    if (v > 15) v = 15;
     int x = (v - 8) / 1 * 2 << 4;
     x = x | (v - 8) / 1 * 2;
 
     writeRegister(EPD_DRIVERVOLTAGE, 0x25, x, -1, -1);
 }
 
+// ************************************************************************************
+// PASSES / VOLTAGE - Pass counts and voltages of updateLegio() adjusted by the update
+// profile of the current temperature (see setUpdateProfiles()). Voltages grow in
+// magnitude with a positive voltageDelta, the source voltage stays within 8..15V.
+// ************************************************************************************
+int PL_smallLegio::passes(int n)
+{
+    n += getProfile().passDelta;
+    return n < 1 ? 1 : n;
+}
+
+int PL_smallLegio::voltage(int v)
+{
+    int d = getProfile().voltageDelta;
+    return v < 0 ? v - d : v + d;
+}
+
 void PL_smallLegio::update(int updateMode, byte coovl, bool manPow)
 {
+    if (_canvas)
+    {
+        updateCanvas();
+        return;
+    }
+    uint32_t hash = hashBytes(buffer, sizeof(buffer));
+    if (skipFrame(hash)) return;
+    beginFrame();
     updateLegio(EPD_BLACK);
+    endFrame(hash);
+}
+
+// ************************************************************************************
+// FRAMES - For the frame store (see setFrameStore()) a screen built from several
+// updateLegio() passes by update(), updateCanvas() or showImage() is one frame: HASH
+// covers all of its planes, the first frame after a restored boot is skipped if it
+// matches, and the snapshot is written once per frame, not once per pass. The hash is
+// built while the planes are loaded for driving, only the first frame after a restored
+// boot loads them ahead. BEGINFRAME resets the plane flags to the planes of this frame
+// and selects the update profile once for all of its passes.
+// Direct updateLegio() calls are not stored.
+// ************************************************************************************
+bool PL_smallLegio::skipFrame(uint32_t hash)
+{
+    int mode = EPD_UPD_FULL;
+    return skipRestored(hash, mode);
+}
+
+void PL_smallLegio::beginFrame()
+{
+    while (poll()) {}
+    selectProfile();                            // One profile for all passes of the frame
+    _inFrame = true;
+    _planes = 0;
+}
+
+void PL_smallLegio::endFrame(uint32_t hash)
+{
+    _inFrame = false;
+    _frameHash = hash;
+    _updateCount++;
+    clearDirtyRect();
+    saveSnapshot(false);
 }
 
 void PL_smallLegio::updateLegio(byte color)
 {
+    while (poll()) {}                           // buffer2 is needed for the passes
     //powerOn();
+    if (!_inFrame) selectProfile();
+    int dwell = getProfile().dwell;
 
     switch (color)
     {
         case EPD_BLACK: // BLACK --> +13V/-13V
 	    {
 		    setTPCOM(0);
-		    setSourceVoltage(13000);
+		    setSourceVoltage(voltage(13000));
 
-		    for (int i = 0; i < 3; i++)
+		    for (int i = 0; i < passes(3); i++)
             {
 			    clear(EPD_LGRAY, true);
 			    writeToPreviousBuffer();
 			    updateLectum(EPD_UPD_FULL);
-			    delay(1);
+			    delay(dwell);
 		    }
 
 		    break;
@@ -161,14 +260,14 @@ void PL_smallLegio::updateLegio(byte color)
         case EPD_WHITE: // WHITE --> +13V/-13V
 	    {
 		    setTPCOM(0);
-		    setSourceVoltage(13000);
+		    setSourceVoltage(voltage(13000));
 
-		    for (int i = 0; i < 3; i++)
+		    for (int i = 0; i < passes(3); i++)
 		    {
 			    clear(EPD_LGRAY, true);
 			    writeToPreviousBuffer();
 			    updateLectum(EPD_UPD_FULL);
-			    delay(1);
+			    delay(dwell);
 		    }
 
 		    invert();
@@ -178,16 +277,17 @@ void PL_smallLegio::updateLegio(byte color)
 
         case EPD_YELLOW: // YELLOW --> 0V/+30V
 	    {
-		    setTPCOM(15000);
-		    setSourceVoltage(15000);
+		    setTPCOM(voltage(15000));
+		    setSourceVoltage(voltage(15000));
 
-		    for (int i = 0; i < 3; i++)
+		    for (int i = 0; i < passes(3); i++)
             {
 			    clear(EPD_LGRAY, true);
 			    writeToPreviousBuffer();
 			    invert();
 			    updateLectum(EPD_UPD_FULL);
 			    invert();
+			    delay(dwell);
 		    }
 
 		    break;
@@ -196,33 +296,37 @@ void PL_smallLegio::updateLegio(byte color)
         case EPD_GREEN: // GREEN --> +12V/-12V
 	    {
 		    setTPCOM(0);
-		    setSourceVoltage(12000);
-		    clear(EPD_WHITE, true);
-		    writeToPreviousBuffer();
-		    updateLectum(EPD_UPD_FULL);
-		    delay(1);
+		    setSourceVoltage(voltage(12000));
+
+		    for (int i = 0; i < passes(1); i++)
+		    {
+			    clear(EPD_WHITE, true);
+			    writeToPreviousBuffer();
+			    updateLectum(EPD_UPD_FULL);
+			    delay(dwell);
+		    }
 
 		    break;
 	    }
 
         case EPD_RED: // RED --> +10V/-10V
 	    {
-		    setSourceVoltage(10000);
+		    setSourceVoltage(voltage(10000));
 
-		    for (int i = 0; i < 2; i++)
+		    for (int i = 0; i < passes(2); i++)
             {
 			    clear(EPD_LGRAY, true);
 			    writeToPreviousBuffer();
 			    invert();
-			    setTPCOM(10000);
+			    setTPCOM(voltage(10000));
 			    updateLectum(EPD_UPD_MONO);
 			    invert();
-			    delay(10);
+			    delay(10 * dwell);
 			    clear(EPD_LGRAY, true);
 			    writeToPreviousBuffer();
-			    setTPCOM(-10000);
+			    setTPCOM(voltage(-10000));
 			    updateLectum(EPD_UPD_MONO);
-			    delay(10);
+			    delay(10 * dwell);
 		    }
 
 		    break;
@@ -230,33 +334,33 @@ void PL_smallLegio::updateLegio(byte color)
 
         case EPD_BLUE: // BLUE --> +12V/-12V
 	    {
-		    for (int i = 0; i < 2; i++)
+		    for (int i = 0; i < passes(2); i++)
 			{
 			    clear(EPD_LGRAY, true);
 			    writeToPreviousBuffer();
-			    setTPCOM(-12000);
-			    setSourceVoltage(12000);
+			    setTPCOM(voltage(-12000));
+			    setSourceVoltage(voltage(12000));
 			    updateLectum(EPD_UPD_MONO);
-			    delay(1);
+			    delay(dwell);
 			    clear(EPD_LGRAY, true);
 			    invert();
 			    writeToPreviousBuffer();
-			    setTPCOM(12000);
-			    setSourceVoltage(12000);
+			    setTPCOM(voltage(12000));
+			    setSourceVoltage(voltage(12000));
 			    updateLectum(EPD_UPD_MONO);
 			    invert();
-			    delay(1);
+			    delay(dwell);
 		    }
 
-		    setSourceVoltage(12000);
-		    setTPCOM(-12000);
+		    setSourceVoltage(voltage(12000));
+		    setTPCOM(voltage(-12000));
 
-		    for (int i = 0; i < 2; i++)
+		    for (int i = 0; i < passes(2); i++)
 			{
 			    clear(EPD_LGRAY, true);
 			    writeToPreviousBuffer();
 			    updateLectum(EPD_UPD_MONO);
-			    delay(1);
+			    delay(dwell);
 		    }
 
 		    break;
@@ -265,4 +369,224 @@ void PL_smallLegio::updateLegio(byte color)
 
     //powerOff();
     delay(1);
+
+    static const byte bit[8] = { 0x80, 0x00, 0x00, 0x04, 0x40, 0x20, 0x10, 0x08 };
+    if (color < 8) _planes |= bit[color];
+}
+
+// ************************************************************************************
+// CANVAS - Optional palette framebuffer: with enableCanvas() all drawing goes into a
+// 3 bit per pixel palette index (EPD_BLACK, EPD_WHITE, EPD_YELLOW..EPD_BLUE) instead of
+// the 2 bit buffer, so a multi-color screen can be drawn in one go. updateCanvas()
+// splits it into the pigment planes and drives only the colors actually in use.
+// The grey levels EPD_DGRAY and EPD_LGRAY have no pigment and are ignored.
+// ************************************************************************************
+void PL_smallLegio::enableCanvas(bool on)
+{
+    _canvas = on;
+    if (on) clearCanvas(EPD_WHITE);
+}
+
+void PL_smallLegio::clearCanvas(byte c)
+{
+    if ((c > EPD_BLUE) || (c == EPD_DGRAY) || (c == EPD_LGRAY)) return;
+
+    for (int k = 0; k < 3; k++) memset(canvas[k], (c >> k) & 1 ? 0xFF : 0x00, sizeof(canvas[k]));
+
+    for (int i = 0; i < 8; i++)
+    {
+        _count[i] = 0;
+        _x0[i] = _width; _y0[i] = _height; _x1[i] = -1; _y1[i] = -1;
+    }
+    _count[c] = (long)_width * _height;
+    _x0[c] = 0; _y0[c] = 0; _x1[c] = _width - 1; _y1[c] = _height - 1;
+    setCursor(0, 0);
+}
+
+void PL_smallLegio::drawPixel(int16_t x, int16_t y, uint16_t color)
+{
+    if (!_canvas)
+    {
+        PL_smallEPD::drawPixel(x, y, color);
+        return;
+    }
+    if ((x < 0) || (x >= _width) || (y < 0) || (y >= _height) || (color > EPD_BLUE) ||
+        (color == EPD_DGRAY) || (color == EPD_LGRAY)) return;
+
+    uint16_t i = x + y * nextline * 4;          // same pixel order as buffer, 1 bit each
+    byte bit = 0x80 >> (i & 7);
+    i >>= 3;
+
+    byte old = 0;
+    for (int k = 0; k < 3; k++) if (canvas[k][i] & bit) old |= 1 << k;
+    if (old == color) return;
+
+    for (int k = 0; k < 3; k++)
+    {
+        if ((color >> k) & 1) canvas[k][i] |= bit;
+        else canvas[k][i] &= ~bit;
+    }
+    _count[old]--;
+    _count[color]++;
+    if (x < _x0[color]) _x0[color] = x;
+    if (x > _x1[color]) _x1[color] = x;
+    if (y < _y0[color]) _y0[color] = y;
+    if (y > _y1[color]) _y1[color] = y;
+}
+
+// ************************************************************************************
+// UPDATECANVAS - Drives the pigment passes in the same order as showImage(). Like in
+// clearScreen() green is built on top of yellow and blue on top of black, so those
+// pixels take part in the yellow resp. black pass as well. The black pass also drives
+// the white background and runs if there is any black, blue or white pixel, the
+// color passes are skipped when empty.
+// ************************************************************************************
+void PL_smallLegio::updateCanvas()
+{
+    static const byte pass[5]   = { EPD_BLACK, EPD_YELLOW, EPD_GREEN, EPD_RED, EPD_BLUE };
+    static const byte colors[5] = { (1 << EPD_BLACK) | (1 << EPD_BLUE), (1 << EPD_YELLOW) | (1 << EPD_GREEN),
+                                    1 << EPD_GREEN, 1 << EPD_RED, 1 << EPD_BLUE };
+    uint32_t hash = hashBytes(&canvas[0][0], sizeof(canvas));
+
+    if (skipFrame(hash)) return;
+    beginFrame();
+    for (int p = 0; p < 5; p++)
+    {
+        long n = 0;                             // The BW pass drives white as well
+        byte used = colors[p] | (p == 0 ? 1 << EPD_WHITE : 0);
+        for (int c = 0; c < 8; c++) if (used & (1 << c)) n += _count[c];
+        if (n == 0) continue;
+
+        extractPlane(colors[p]);
+        updateLegio(pass[p]);
+    }
+    memset(buffer, 0xFF, sizeof(buffer));
+    endFrame(hash);
+}
+
+long PL_smallLegio::getColorCount(byte color)
+{
+    return (color < 8) ? _count[color] : 0;
+}
+
+// ************************************************************************************
+// GETCOLORBOUNDS - Bounding box of all pixels ever drawn in COLOR since the last
+// clearCanvas(). It only grows, overdrawn pixels are not subtracted again.
+// ************************************************************************************
+bool PL_smallLegio::getColorBounds(byte color, int16_t &x0, int16_t &y0, int16_t &x1, int16_t &y1)
+{
+    if ((color > 7) || (_count[color] == 0)) return false;
+    x0 = _x0[color]; y0 = _y0[color]; x1 = _x1[color]; y1 = _y1[color];
+    return true;
+}
+
+// ************************************************************************************
+// DRAWCOLOR - Dithers an 8 bit RGB image of W x H pixels (W <= EPD_DITHER_MAXWIDTH) to
+// the six Legio colors and draws it into the canvas at X, Y, the canvas is enabled if
+// needed. GETROW has to deliver W RGB triplets per row, MODE as for drawGray().
+// ************************************************************************************
+void PL_smallLegio::drawColor(int16_t x, int16_t y, int16_t w, int16_t h, EPD_rowReader getRow,
+    void *ctx, uint8_t mode)
+{
+    uint8_t rgb[EPD_DITHER_MAXWIDTH * 3], idx[EPD_DITHER_MAXWIDTH];
+    PL_smallDither dither;
+
+    if ((w <= 0) || (w > EPD_DITHER_MAXWIDTH)) return;
+    if (!_canvas) enableCanvas();
+
+    dither.begin(mode, w);
+    for (int16_t r = 0; r < h; r++)
+    {
+        if (!getRow(r, rgb, ctx)) return;
+        dither.rgbRow(rgb, idx);
+        for (int16_t i = 0; i < w; i++) drawPixel(x + i, y + r, idx[i]);
+    }
+}
+
+// ************************************************************************************
+// WRITEPATCHROW - Patch rows for the canvas (see applyPatches()). Without a plane the
+// pixels are drawn as they are, with a plane EPD_BLACK pixels set that color and all
+// others remove it again, i.e. a patch carries the same picture as one updateLegio()
+// pass. Without the canvas the rows go straight into the buffer.
+// ************************************************************************************
+void PL_smallLegio::writePatchRow(int16_t x, int16_t y, int16_t w, const byte *row, byte plane)
+{
+    if (!_canvas)
+    {
+        PL_smallEPD::writePatchRow(x, y, w, row, plane);
+        return;
+    }
+    for (int16_t i = 0; i < w; i++)
+    {
+        byte c = (row[i / 4] >> (6 - 2 * (i % 4))) & 0x03;
+        if (plane != EPD_PATCH_NOPLANE)
+        {
+            if (c == EPD_BLACK) c = plane;
+            else if (getCanvasPixel(x + i, y) == plane) c = EPD_WHITE;
+            else continue;
+        }
+        drawPixel(x + i, y, c);
+    }
+}
+
+byte PL_smallLegio::getCanvasPixel(int16_t x, int16_t y)
+{
+    if ((x < 0) || (x >= _width) || (y < 0) || (y >= _height)) return EPD_WHITE;
+
+    uint16_t i = x + y * nextline * 4;
+    byte bit = 0x80 >> (i & 7), c = 0;
+    i >>= 3;
+    for (int k = 0; k < 3; k++) if (canvas[k][i] & bit) c |= 1 << k;
+    return c;
+}
+
+// ************************************************************************************
+// EXTRACTPLANE - Renders all canvas pixels whose index is set in the bit mask COLORS
+// as EPD_BLACK into the buffer, everything else as EPD_WHITE. 32 pixels are compared
+// at once, only the rows inside the bounding boxes of the wanted colors are visited.
+// ************************************************************************************
+void PL_smallLegio::extractPlane(byte colors)
+{
+    int16_t y0 = _height, y1 = -1;
+    for (int c = 0; c < 8; c++)
+    {
+        if (!(colors & (1 << c)) || (_count[c] == 0)) continue;
+        if (_y0[c] < y0) y0 = _y0[c];
+        if (_y1[c] > y1) y1 = _y1[c];
+    }
+
+    memset(buffer, 0xFF, sizeof(buffer));
+    if (y1 < y0) return;
+
+    int w0 = (long)y0 * nextline / 2 / 4;
+    int w1 = ((long)(y1 + 1) * nextline / 2 + 3) / 4;
+    if (w1 > (int)(sizeof(canvas[0]) / 4)) w1 = sizeof(canvas[0]) / 4;
+
+    for (int w = w0; w < w1; w++)
+    {
+        uint32_t p[3], m = 0;
+        for (int k = 0; k < 3; k++) memcpy(&p[k], &canvas[k][w * 4], 4);
+
+        for (int c = 0; c < 8; c++)
+        {
+            if (!(colors & (1 << c))) continue;
+            uint32_t hit = 0xFFFFFFFF;
+            for (int k = 0; k < 3; k++) hit &= ((c >> k) & 1) ? p[k] : ~p[k];
+            m |= hit;
+        }
+        if (m == 0) continue;
+
+        byte mb[4];
+        memcpy(mb, &m, 4);
+        for (int j = 0; j < 4; j++)
+        {
+            uint16_t x = mb[j];                 // 1 bit -> 2 bit per pixel, MSB first
+            x = (x | (x << 4)) & 0x0F0F;
+            x = (x | (x << 2)) & 0x3333;
+            x = (x | (x << 1)) & 0x5555;
+            x = ~(x | (x << 1));
+            buffer[(w * 4 + j) * 2]     = highByte(x);
+            buffer[(w * 4 + j) * 2 + 1] = lowByte(x);
+        }
+    }
 }
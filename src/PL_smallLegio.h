@@ -32,15 +32,37 @@ public:
     PL_smallLegio(int8_t _cs, int8_t _rst, int8_t _busy);
     void clearScreen(int8_t BGcolor);
     void showImage(const unsigned char *pic_name); 
+    bool showImage(const unsigned char *bundle, uint16_t id);
     void loadImage(const unsigned char *pic_name, int BUFFER_COLOR_START=BUFFER_BW_START);
     void setSourceVoltage(int v);
     void setTPCOM(int v, bool VkbConsidered=false);
     void update(int updateMode=EPD_UPD_FULL, byte coovl=EPD_COOVL, bool manPow=false);
     void updateLegio(byte color);
+    void drawPixel(int16_t x, int16_t y, uint16_t color);
+    void enableCanvas(bool on=true);
+    void clearCanvas(byte c=EPD_WHITE);
+    void updateCanvas(void);
+    long getColorCount(byte color);
+    bool getColorBounds(byte color, int16_t &x0, int16_t &y0, int16_t &x1, int16_t &y1);
+    void drawColor(int16_t x, int16_t y, int16_t w, int16_t h, EPD_rowReader getRow, void *ctx,
+        uint8_t mode=EPD_DITHER_FS);
 
 
 private:
     int cs, rst, busy;
+    bool _canvas=false;
+    bool _inFrame=false;
+    byte canvas[3][EPD_WIDTH * EPD_HEIGHT / 8];   // Palette index, one bit plane per index bit
+    long _count[8] = {};
+    int16_t _x0[8], _y0[8], _x1[8], _y1[8];
+    void extractPlane(byte colors);
+    void writePatchRow(int16_t x, int16_t y, int16_t w, const byte *row, byte plane);
+    byte getCanvasPixel(int16_t x, int16_t y);
+    bool skipFrame(uint32_t hash);
+    void beginFrame(void);
+    void endFrame(uint32_t hash);
+    int passes(int n);
+    int voltage(int v);
 };
 
 #endif
@@ -0,0 +1,34 @@
+/* *****************************************************************************************
+PL_smallEPD - A library for 1.1”, 1.4", 2.1" and 3.1" E-Paper displays (EPDs) from 
+Plastic Logic based on UC8156 driver IC for Adafruit GFX core library. The communication is 
+SPI-based, for more information about hook-up please check: https://github.com/plasticlogic.
+
+Created by Robert Poser, Mar 30th 2021, Dresden/Germany. Released under BSD license
+(3-clause BSD license), check license.md for more information.
+
+We invested time and resources providing this open source code, please support Plasticlogic 
+and open source hardware by purchasing this product @Plasticlogic
+***************************************************************************************** */
+#ifndef PL_smallPatch_h
+#define PL_smallPatch_h
+
+// Delta patch stream, read by PL_smallEPD::applyPatches() and written e.g. by
+// extras/patchEncoder. A stream is a sequence of records, each starting with an opcode:
+//
+//   EPD_PATCH_RECT    uint16 x, y, w, h (little endian), uint8 plane, followed by the
+//                     h rows of the rectangle, (w+3)/4 bytes each, 2 bit per pixel with
+//                     the first pixel in the MSB, all rows PL_smallRLE coded in one go.
+//                     PLANE is EPD_PATCH_NOPLANE or a Legio color (EPD_BLACK, EPD_YELLOW
+//                     ..EPD_BLUE) the rectangle belongs to.
+//   EPD_PATCH_UPDATE  uint8 update mode hint (EPD_UPD_FULL/_PART/_MONO), ends the stream
+//   EPD_PATCH_END     ends the stream without asking for an update
+
+#define EPD_PATCH_RECT      'P'
+#define EPD_PATCH_UPDATE    'U'
+#define EPD_PATCH_END       'E'
+#define EPD_PATCH_NOPLANE   0xFF
+
+#define EPD_PATCH_NONE      -1      // applyPatches(): stream ended without update hint
+#define EPD_PATCH_ERROR     -2      // applyPatches(): timeout or malformed record
+
+#endif
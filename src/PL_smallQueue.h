@@ -0,0 +1,77 @@
+/* *****************************************************************************************
+PL_smallEPD - A library for 1.1”, 1.4", 2.1" and 3.1" E-Paper displays (EPDs) from 
+Plastic Logic based on UC8156 driver IC for Adafruit GFX core library. The communication is 
+SPI-based, for more information about hook-up please check: https://github.com/plasticlogic.
+
+Created by Robert Poser, Mar 30th 2021, Dresden/Germany. Released under BSD license
+(3-clause BSD license), check license.md for more information.
+
+We invested time and resources providing this open source code, please support Plasticlogic 
+and open source hardware by purchasing this product @Plasticlogic
+***************************************************************************************** */
+#ifndef PL_smallQueue_h
+#define PL_smallQueue_h
+
+#include <stdint.h>
+#include <atomic>                   // Needs a C++11 toolchain with atomics (ESP32, nRF52, host)
+
+// ************************************************************************************
+// PL_SMALLQUEUE - Bounded lock-free queue for many producers and one consumer. Every
+// cell carries a sequence number telling whether it is free for the producer owning
+// ticket POS (seq == pos) or filled for the consumer (seq == pos + 1), so producers
+// only race on the tail index and never block. N has to be a power of two.
+// ************************************************************************************
+template <class T, unsigned N>
+class PL_smallQueue {
+
+public:
+    PL_smallQueue() {
+        static_assert((N & (N - 1)) == 0, "PL_smallQueue size must be a power of two");
+        for (unsigned i = 0; i < N; i++)
+            cells[i].seq.store(i, std::memory_order_relaxed);
+        head.store(0, std::memory_order_relaxed);
+        tail.store(0, std::memory_order_relaxed);
+    }
+
+    // PUSH - Safe from any number of tasks; returns FALSE if the queue is full
+    bool push(const T &v) {
+        unsigned pos = tail.load(std::memory_order_relaxed);
+        Cell *c;
+        for (;;) {
+            c = &cells[pos & (N - 1)];
+            int diff = (int)(c->seq.load(std::memory_order_acquire) - pos);
+            if (diff == 0) {
+                if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0)
+                return false;
+            else
+                pos = tail.load(std::memory_order_relaxed);
+        }
+        c->data = v;
+        c->seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // POP - Consumer side only; returns FALSE if nothing is waiting
+    bool pop(T &v) {
+        unsigned pos = head.load(std::memory_order_relaxed);
+        Cell *c = &cells[pos & (N - 1)];
+        if ((int)(c->seq.load(std::memory_order_acquire) - (pos + 1)) < 0)
+            return false;
+        v = c->data;
+        c->seq.store(pos + N, std::memory_order_release);
+        head.store(pos + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+private:
+    struct Cell {
+        std::atomic<unsigned> seq;
+        T data;
+    };
+    Cell cells[N];
+    std::atomic<unsigned> head, tail;
+};
+
+#endif
@@ -0,0 +1,98 @@
+/* *****************************************************************************************
+PL_smallEPD - A library for 1.1”, 1.4", 2.1" and 3.1" E-Paper displays (EPDs) from 
+Plastic Logic based on UC8156 driver IC for Adafruit GFX core library. The communication is 
+SPI-based, for more information about hook-up please check: https://github.com/plasticlogic.
+
+Created by Robert Poser, Mar 30th 2021, Dresden/Germany. Released under BSD license
+(3-clause BSD license), check license.md for more information.
+
+We invested time and resources providing this open source code, please support Plasticlogic 
+and open source hardware by purchasing this product @Plasticlogic
+***************************************************************************************** */
+#include "PL_smallRLE.h"
+
+// ************************************************************************************
+// BEGIN - Starts decoding a new stream; bytes are pulled one by one via READ, so the
+// source can be flash, a Stream or an external memory.
+// ************************************************************************************
+void PL_smallRLE::begin(EPD_byteReader read, void *ctx) {
+    _read = read;
+    _ctx = ctx;
+    _left = 0;
+}
+
+// ************************************************************************************
+// READ - Decodes up to N bytes into DST and returns how many were produced, which is
+// less than N only if the source ran dry. Packets may span several calls.
+// ************************************************************************************
+int PL_smallRLE::read(uint8_t *dst, int n) {
+    int i = 0;
+    while (i < n) {
+        if (_left == 0) {
+            int h = _read(_ctx);
+            if (h < 0) break;
+            _repeat = h & 0x80;
+            _left = _repeat ? h - 0x80 + 3 : h + 1;
+            if (_repeat) {
+                int v = _read(_ctx);
+                if (v < 0) {
+                    _left = 0;
+                    break;
+                }
+                _value = v;
+            }
+        }
+        if (_repeat) {
+            for (; _left > 0 && i < n; _left--)
+                dst[i++] = _value;
+        } else {
+            for (; _left > 0 && i < n; _left--) {
+                int v = _read(_ctx);
+                if (v < 0) {
+                    _left = 0;
+                    return i;
+                }
+                dst[i++] = v;
+            }
+        }
+    }
+    return i;
+}
+
+// ************************************************************************************
+// ENCODE - Compresses N bytes of SRC, handing the result byte by byte to WRITE. Returns
+// the encoded size; without WRITE the size is only calculated.
+// ************************************************************************************
+long PL_smallRLE::encode(const uint8_t *src, long n, EPD_byteWriter write, void *ctx) {
+    long size = 0, i = 0, lit = 0;                      // lit = start of pending literals
+
+    while (i <= n) {
+        long run = 1;
+        if (i < n)
+            while (i + run < n && run < 130 && src[i + run] == src[i]) run++;
+
+        if (i == n || run >= 3 || i - lit == 128) {     // flush pending literals
+            while (lit < i) {
+                long k = i - lit > 128 ? 128 : i - lit;
+                if (write) {
+                    write((uint8_t)(k - 1), ctx);
+                    for (long j = 0; j < k; j++) write(src[lit + j], ctx);
+                }
+                size += k + 1;
+                lit += k;
+            }
+        }
+        if (i == n) break;
+        if (run >= 3) {
+            if (write) {
+                write((uint8_t)(0x80 + run - 3), ctx);
+                write(src[i], ctx);
+            }
+            size += 2;
+            i += run;
+            lit = i;
+        } else
+            i++;
+    }
+    return size;
+}
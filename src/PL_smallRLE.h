@@ -0,0 +1,38 @@
+/* *****************************************************************************************
+PL_smallEPD - A library for 1.1”, 1.4", 2.1" and 3.1" E-Paper displays (EPDs) from 
+Plastic Logic based on UC8156 driver IC for Adafruit GFX core library. The communication is 
+SPI-based, for more information about hook-up please check: https://github.com/plasticlogic.
+
+Created by Robert Poser, Mar 30th 2021, Dresden/Germany. Released under BSD license
+(3-clause BSD license), check license.md for more information.
+
+We invested time and resources providing this open source code, please support Plasticlogic 
+and open source hardware by purchasing this product @Plasticlogic
+***************************************************************************************** */
+#ifndef PL_smallRLE_h
+#define PL_smallRLE_h
+
+#include <stdint.h>                 // No Arduino dependencies, builds on the host as well
+
+// Byte oriented run length code (PackBits style), every packet starts with a header byte:
+//   0x00..0x7F  n+1 literal bytes follow (1..128)
+//   0x80..0xFF  the next byte is repeated n-0x80+3 times (3..130)
+
+typedef int  (*EPD_byteReader)(void *ctx);              // next byte, -1 if none left
+typedef void (*EPD_byteWriter)(uint8_t b, void *ctx);
+
+class PL_smallRLE {
+
+public:
+    void begin(EPD_byteReader read, void *ctx);
+    int read(uint8_t *dst, int n);
+    static long encode(const uint8_t *src, long n, EPD_byteWriter write=0, void *ctx=0);
+
+private:
+    EPD_byteReader _read;
+    void *_ctx;
+    uint8_t _left, _value;
+    bool _repeat;
+};
+
+#endif
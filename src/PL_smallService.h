@@ -0,0 +1,240 @@
+/* *****************************************************************************************
+PL_smallEPD - A library for 1.1”, 1.4", 2.1" and 3.1" E-Paper displays (EPDs) from 
+Plastic Logic based on UC8156 driver IC for Adafruit GFX core library. The communication is 
+SPI-based, for more information about hook-up please check: https://github.com/plasticlogic.
+
+Created by Robert Poser, Mar 30th 2021, Dresden/Germany. Released under BSD license
+(3-clause BSD license), check license.md for more information.
+
+We invested time and resources providing this open source code, please support Plasticlogic 
+and open source hardware by purchasing this product @Plasticlogic
+***************************************************************************************** */
+#ifndef PL_smallService_h
+#define PL_smallService_h
+
+#include <string.h>
+#include "PL_smallQueue.h"
+#ifdef ARDUINO
+#include "PL_smallEPD.h"
+#endif
+
+// Backend: a FreeRTOS task on ESP32 / nRF52, std::thread everywhere else. Define
+// EPD_SERVICE_STDTHREAD before including this file to force std::thread.
+#if defined(EPD_SERVICE_STDTHREAD) || !(defined(ESP32) || defined(ARDUINO_ARCH_NRF52))
+#define EPD_SERVICE_STDTHREAD
+#include <thread>
+#include <chrono>
+#endif
+
+#ifndef EPD_SERVICE_QUEUE
+#define EPD_SERVICE_QUEUE   32      // Commands waiting at most, power of two
+#endif
+
+#define EPD_CMD_PIXEL     0x01      // x, y, color
+#define EPD_CMD_FILLRECT  0x02      // x, y, w, h, color
+#define EPD_CMD_LINE      0x03      // x, y -> w, h (end point), color
+#define EPD_CMD_TEXT      0x04      // x, y, color, text
+#define EPD_CMD_CLEAR     0x05      // color
+#define EPD_CMD_PATCH     0x06      // x, y, w, h, data: packed 2 bit rows, first pixel in MSB
+#define EPD_CMD_UPDATE    0x07      // color = update mode for the current batch
+
+struct EPD_command {
+    uint8_t op, color;
+    int16_t x, y, w, h;
+    const uint8_t *data;            // EPD_CMD_PATCH: has to stay valid, e.g. const or static
+    char text[16];
+};
+
+// ************************************************************************************
+// PL_SMALLSERVICE - Owns a display on its own task. Any task may submit() commands, they
+// are queued lock-free and never wait for the panel. The service task drains everything
+// queued, applies it to the framebuffer in one go and triggers a single update for the
+// whole batch, so producers are never stalled by a running waveform. The display must
+// not be used directly by anyone else while the service runs.
+// ************************************************************************************
+template <class EPD>
+class PL_smallService {
+
+public:
+    PL_smallService(EPD &display) : epd(display) {}
+
+    // BEGIN - Starts the service task. Every batch ends with an update in UPDATEMODE,
+    // unless an EPD_CMD_UPDATE asked for another one; BATCHMS is waited after the first
+    // command of a batch to collect the ones following shortly after.
+    void begin(int updateMode=EPD_UPD_PART, unsigned batchMs=20, unsigned idleMs=10,
+        unsigned stackSize=4096, unsigned priority=1) {
+        _updateMode = updateMode;
+        _batchMs = batchMs;
+        _idleMs = idleMs;
+        _running.store(true);
+        _stopped.store(false);
+#ifdef EPD_SERVICE_STDTHREAD
+        (void)stackSize; (void)priority;
+        _thread = std::thread(task, this);
+#else
+        xTaskCreate(task, "PL_smallService", stackSize, this, priority, &_handle);
+#endif
+    }
+
+    // END - Stops the service after the current batch and waits until the task is gone,
+    // so the service and its display may be destroyed right afterwards
+    void end() {
+        _running.store(false);
+#ifdef EPD_SERVICE_STDTHREAD
+        if (_thread.joinable())
+            _thread.join();
+#else
+        while (!_stopped.load())
+            sleep(1);
+#endif
+    }
+
+    bool submit(const EPD_command &c) {
+        if (queue.push(c))
+            return true;
+        _dropped.fetch_add(1);
+        return false;
+    }
+
+    bool pixel(int16_t x, int16_t y, uint8_t color) {
+        EPD_command c = make(EPD_CMD_PIXEL, x, y, 0, 0, color);
+        return submit(c);
+    }
+
+    bool fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t color) {
+        EPD_command c = make(EPD_CMD_FILLRECT, x, y, w, h, color);
+        return submit(c);
+    }
+
+    bool line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t color) {
+        EPD_command c = make(EPD_CMD_LINE, x0, y0, x1, y1, color);
+        return submit(c);
+    }
+
+    bool text(int16_t x, int16_t y, const char *s, uint8_t color) {
+        EPD_command c = make(EPD_CMD_TEXT, x, y, 0, 0, color);
+        strncpy(c.text, s, sizeof(c.text) - 1);
+        return submit(c);
+    }
+
+    bool clear(uint8_t color) {
+        EPD_command c = make(EPD_CMD_CLEAR, 0, 0, 0, 0, color);
+        return submit(c);
+    }
+
+    bool patch(int16_t x, int16_t y, int16_t w, int16_t h, const uint8_t *data) {
+        EPD_command c = make(EPD_CMD_PATCH, x, y, w, h, 0);
+        c.data = data;
+        return submit(c);
+    }
+
+    bool requestUpdate(uint8_t updateMode) {
+        EPD_command c = make(EPD_CMD_UPDATE, 0, 0, 0, 0, updateMode);
+        return submit(c);
+    }
+
+    unsigned long getCommands() { return _commands.load(); }   // applied so far
+    unsigned long getBatches()  { return _batches.load(); }    // updates triggered
+    unsigned long getDropped()  { return _dropped.load(); }    // rejected, queue full
+
+private:
+    EPD &epd;
+    PL_smallQueue<EPD_command, EPD_SERVICE_QUEUE> queue;
+    std::atomic<bool> _running{false}, _stopped{true};
+    std::atomic<unsigned long> _commands{0}, _batches{0}, _dropped{0};
+    int _updateMode;
+    unsigned _batchMs, _idleMs;
+#ifdef EPD_SERVICE_STDTHREAD
+    std::thread _thread;
+#else
+    TaskHandle_t _handle;
+#endif
+
+    static EPD_command make(uint8_t op, int16_t x, int16_t y, int16_t w, int16_t h, uint8_t color) {
+        EPD_command c;
+        c.op = op; c.color = color;
+        c.x = x; c.y = y; c.w = w; c.h = h;
+        c.data = 0;
+        c.text[0] = 0;
+        c.text[sizeof(c.text) - 1] = 0;
+        return c;
+    }
+
+    static void sleep(unsigned ms) {
+#ifdef EPD_SERVICE_STDTHREAD
+        std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+#else
+        vTaskDelay(pdMS_TO_TICKS(ms));
+#endif
+    }
+
+    static void task(void *arg) {
+        PL_smallService *s = (PL_smallService *)arg;
+        while (s->_running.load())
+            s->runBatch();
+        s->_stopped.store(true);                    // S must not be touched after this
+#ifndef EPD_SERVICE_STDTHREAD
+        vTaskDelete(NULL);
+#endif
+    }
+
+    void runBatch() {
+        EPD_command c;
+        if (!queue.pop(c)) {
+            sleep(_idleMs);
+            return;
+        }
+        sleep(_batchMs);
+
+        bool dirty = false;
+        int mode = -1;
+        do {
+            if (c.op == EPD_CMD_UPDATE) {
+                if (mode < 0 || c.color < mode)     // the more thorough mode wins
+                    mode = c.color;
+            } else {
+                apply(c);
+                dirty = true;
+            }
+            _commands.fetch_add(1);
+        } while (queue.pop(c));
+
+        if (mode < 0 && dirty)
+            mode = _updateMode;
+        if (mode >= 0) {
+            epd.update(mode);
+            _batches.fetch_add(1);
+        }
+    }
+
+    void apply(const EPD_command &c) {
+        switch (c.op) {
+            case EPD_CMD_PIXEL:
+                epd.drawPixel(c.x, c.y, c.color);
+                break;
+            case EPD_CMD_FILLRECT:
+                epd.fillRect(c.x, c.y, c.w, c.h, c.color);
+                break;
+            case EPD_CMD_LINE:
+                epd.drawLine(c.x, c.y, c.w, c.h, c.color);
+                break;
+            case EPD_CMD_TEXT:
+                epd.setCursor(c.x, c.y);
+                epd.setTextColor(c.color);
+                epd.print(c.text);
+                break;
+            case EPD_CMD_CLEAR:
+                epd.clear(c.color);
+                break;
+            case EPD_CMD_PATCH:
+                for (int16_t j = 0; j < c.h; j++)
+                    for (int16_t i = 0; i < c.w; i++) {
+                        uint8_t b = c.data[j * ((c.w + 3) / 4) + i / 4];
+                        epd.drawPixel(c.x + i, c.y + j, (b >> (6 - 2 * (i & 3))) & 0x03);
+                    }
+                break;
+        }
+    }
+};
+
+#endif